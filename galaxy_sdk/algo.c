@@ -2,7 +2,9 @@
 #include <string.h>
 #include <math.h>
 #include <stdio.h>
-#include "osal_heap_api.h"
+#include "riscv_math.h"
+#include "algo.h"
+#include "mfcc_tables.h"
 
 
 // 启用RISC-V P扩展指令加速乘法
@@ -15,433 +17,1523 @@ void q15_multiply(int16_t *a, int16_t *b, int16_t *c, int len) {
 }
 */
 
-#define SAMPLE_RATE_HZ     8000
 #define BLOCK_DURATION_S   1.5f
-//#define SAMPLES_PER_BLOCK  (uint16_t)(SAMPLE_RATE_HZ * BLOCK_DURATION_S) // 12,000
-#define TOTAL_BLOCKS       4 // 48,000 / 12,000
-// 计算公式：帧数 = (总样本数 - 帧长) / 帧移 + 1
-#define SAMPLES_PER_BLOCK 12000  // 1.5s * 8000Hz
-#define FRAME_LEN 400            // 50ms帧长
-#define FRAME_SHIFT 160          // 20ms帧移
-#define FRAMES_PER_BLOCK ((SAMPLES_PER_BLOCK - FRAME_LEN) / FRAME_SHIFT )  // =72帧
-#define N_COMPONENTS 64
-#define N_FEATURES 13       // MFCC特征维度
+#define TOTAL_BLOCKS       4 // 6秒缓冲分4块
+// 各采样率的帧移都是20ms：块长1.5秒为75个帧移，每块取前72帧
+// （8kHz: (12000-400)/160=72；16kHz帧长更长，(24000-512)/320=73，同样只用前72帧，两端分块一致）
+#define FRAMES_PER_BLOCK 72
+#define HOPS_PER_BLOCK 75  // 流式提取时每块的帧移数
+#ifndef N_COMPONENTS
+#define N_COMPONENTS 64     // GMM分量数，需与python代码/main.py训练时一致
+#endif
+#ifndef GMM_TOP_C
+#define GMM_TOP_C 5         // 说话人模型只计算UBM得分最高的GMM_TOP_C个分量，0为完整打分
+#endif
+#ifndef PI                // riscv_math.h已定义单精度PI
 #define PI 3.14159265358979323846
+#endif
 #define MEL_FILTERS 40     // 梅尔滤波器数量
-#define FFT_LEN 400
 
-
-typedef struct {
-    uint16_t frame_data[FRAME_LEN];  // 帧音频数据（400字节）
-    int start_time;               // 帧起始时间（秒）
-    int energy;                    //分贝
-    uint16_t mfcc[N_FEATURES];
-    int is_speech;
-    //int result;
-} AudioFrame;
-
-// 分块存储结构：每个块包含72帧
+// 窗、梅尔滤波器、DCT和log2查表由gen_mfcc_tables.py按以上参数生成，每种采样率一套帧参数和表
+// 工程没有自带的构建脚本，mfcc_tables.h随源码提交，不在编译时生成：修改参数后在仓库根目录手动运行
+//   python python代码/gen_mfcc_tables.py -o galaxy_sdk/mfcc_tables.h
+// 并把重新生成的头文件一起提交，下面的检查只用来发现两边参数不一致
+#if (MFCC_TABLE_MEL_FILTERS != MEL_FILTERS) || (MFCC_TABLE_N_MFCC != N_MFCC) || \
+    (MFCC8K_FRAME_SHIFT * 50 != MFCC8K_SAMPLE_RATE) || (MFCC8K_FRAME_LEN > MFCC_MAX_FRAME_LEN) || \
+    (MFCC16K_FRAME_SHIFT * 50 != MFCC16K_SAMPLE_RATE) || (MFCC16K_FRAME_LEN > MFCC_MAX_FRAME_LEN)
+#error "mfcc_tables.h与algo.c的参数不一致，请重新运行gen_mfcc_tables.py"
+#endif
+#define MFCC_MAX_FFT_LEN 512
+// 倒谱均值方差归一化（CMVN）开关，需与训练端AudioProcessor的cmvn参数（main.py的USE_CMVN）一致。
+// 目前仓库中的模型都是用未归一化的MFCC训练的，默认关闭；用USE_CMVN = True重新训练并导出模型后再打开
+#ifndef CMVN_ENABLE
+#define CMVN_ENABLE 0
+#endif
+#define CMVN_WINDOW 200          // 统计窗口（帧），约4秒语音，对应遗忘因子1-1/200
+
+// 非0时每块结果后打印两级门限的跳帧统计
+#ifndef GATE_STATS_LOG
+#define GATE_STATS_LOG 0
+#endif
+
+// MFCC前端选择（编译期）：0-浮点前端，1-定点前端（PDM采样到13维倒谱全程Q15/Q31）
+#ifndef MFCC_FRONTEND_Q15
+#define MFCC_FRONTEND_Q15 0
+#endif
+
+
+// 特征存储（结构体数组改为数组结构体）：6秒共288帧，约15KB
+// 帧在采集缓冲区中的位置由块号和帧号推出（audio_blocks[块] + 帧号*帧移），不再单独保存
+// 只有语音帧提取特征：每块的语音帧特征从块内第0帧的位置起紧凑存放，共speech_frames[块]帧
+#define TOTAL_FRAMES (TOTAL_BLOCKS * FRAMES_PER_BLOCK)   // =288帧
+
+// 每块的两级门限统计，用于调节门限（功耗与识别率的折中），见GATE_STATS_LOG
 typedef struct {
-    AudioFrame frames[FRAMES_PER_BLOCK];
-} BlockFrames;
+    uint8_t frames;          // 块内帧数
+    uint8_t gate_skipped;    // 第一级（能量/过零率）拒绝，未做VAD判决和FFT
+    uint8_t vad_skipped;     // 通过第一级、被VAD判为非语音
+} GateStats;
 
-// 全局存储（4个块）
-BlockFrames processed_blocks[TOTAL_BLOCKS];  // TOTAL_BLOCKS=4
+typedef struct {
+    float mfcc[TOTAL_FRAMES][N_FEATURES];             // 连续的特征矩阵，打分时顺序读取
+    int16_t energy[TOTAL_FRAMES];                     // 分贝
+    uint32_t speech_mask[(TOTAL_FRAMES + 31) / 32];   // 语音帧位图
+    uint8_t speech_frames[TOTAL_BLOCKS];              // 每块的语音帧数
+    uint8_t block_silent[TOTAL_BLOCKS];               // 整块静音，跳过特征提取和打分
+    GateStats gate_stats[TOTAL_BLOCKS];
+} FeatureStore;
+
+static FeatureStore features __attribute__((aligned(64)));
 // 分块结果：指针数组（每个指针指向一个1.5秒块的起始地址）
 uint16_t* audio_blocks[TOTAL_BLOCKS];
 
-void compute_mfcc(uint16_t* input_frame, uint16_t* mfcc_out, float sample_rate);
+static inline void set_speech(int frame, int is_speech) {
+    if (is_speech) {
+        features.speech_mask[frame >> 5] |= 1u << (frame & 31);
+    } else {
+        features.speech_mask[frame >> 5] &= ~(1u << (frame & 31));
+    }
+}
+
+static inline int frame_is_speech(int frame) {
+    return (features.speech_mask[frame >> 5] >> (frame & 31)) & 1;
+}
+
+// MFCC特征提取后端：输入一帧有符号16位PCM，输出N_MFCC维浮点倒谱
+typedef struct {
+    const char* name;
+    void (*init)(void);                                     // 可为NULL
+    void (*compute)(const int16_t* frame, float* mfcc_out);
+    // 批量计算n（<= MFCC_BATCH_MAX）帧，mfcc_out为[n][N_MFCC]；可为NULL
+    void (*compute_batch)(const int16_t* const* frames, int n, float* mfcc_out);
+} MfccBackend;
+
+// 采样率配置：帧参数、前端内核、采集高通系数和模型目录（不同采样率的特征不通用，模型分开训练）
+typedef struct {
+    uint32_t sample_rate;
+    uint16_t frame_len;
+    uint16_t frame_shift;
+    uint32_t samples_per_block;              // 1.5秒
+    const MfccBackend* backends;             // [MFCC_BACKEND_NUM]
+    const float32_t* hpf_coefs;
+    const char* model_dir;
+} MfccRateConfig;
+
+static const MfccRateConfig* mfcc_rate;   // 当前采样率配置，见mfcc_select_rate
+static const MfccBackend* mfcc_backend;   // 特征提取使用的后端（当前采样率的自带前端），见mfcc_select_rate
 void dataloader(uint16_t* raw_data);
 void split_audio_into_blocks (uint16_t* raw_data) {
     for (int block_idx = 0; block_idx < TOTAL_BLOCKS; block_idx++) {
         // 计算当前块的起始指针位置（零拷贝）
-        uint16_t* block_start = (uint16_t*)(raw_data + (block_idx * SAMPLES_PER_BLOCK));
+        uint16_t* block_start = (uint16_t*)(raw_data + (block_idx * mfcc_rate->samples_per_block));
         audio_blocks[block_idx] = block_start;
     }
 }
 
-void split_into_frames(uint16_t** audio_blocks) {
-    int current_time = 0;  // 起始时间从0开始
+// 取环形缓冲区中从offset开始的一帧（frame_len个采样）：不跨越末尾时直接返回缓冲区内的指针，跨越时拼接到scratch
+static const int16_t* ring_frame(const int16_t* ring, uint32_t ring_len, uint32_t offset, uint32_t frame_len,
+                                 int16_t* scratch) {
+    offset %= ring_len;
+    if (offset + frame_len <= ring_len) {
+        return ring + offset;
+    }
+    uint32_t head = ring_len - offset;
+    memcpy(scratch, ring + offset, head * sizeof(int16_t));
+    memcpy(scratch + head, ring, (frame_len - head) * sizeof(int16_t));
+    return scratch;
+}
+
+//帧能量（分贝）与语音活动检测，非语音帧不再提取特征和打分
 
-    for (int block_idx = 0; block_idx < TOTAL_BLOCKS; block_idx++) {
-        uint16_t* block_data = audio_blocks[block_idx];
+#define LOG2_LUT_BITS          MFCC_TABLE_LOG2_LUT_BITS   // log2查表索引位数
+#define DB_PER_LOG2_Q16        197283   // 10*log10(2) * 2^16
 
-        for (int frame_idx = 0; frame_idx < FRAMES_PER_BLOCK; frame_idx++) {
-            int offset = frame_idx * FRAME_SHIFT;
+// 定点log2：查表加线性插值，返回Q16
+static int32_t log2_q16(uint64_t x) {
+    if (x == 0) x = 1;
+    int msb = 63 - __builtin_clzll(x);
 
-            memcpy(
-                processed_blocks[block_idx].frames[frame_idx].frame_data,
-                block_data + offset,
-                FRAME_LEN
-            );
+    // 取最高位之后的16位作为尾数小数部分
+    uint32_t frac = (msb >= 16) ? (uint32_t)(x >> (msb - 16)) : (uint32_t)(x << (16 - msb));
+    frac &= 0xFFFF;
+    int idx = frac >> (16 - LOG2_LUT_BITS);
+    int32_t rem = frac & ((1 << (16 - LOG2_LUT_BITS)) - 1);
+    int32_t y0 = MFCC_LOG2_LUT_Q16[idx];
+    int32_t y1 = MFCC_LOG2_LUT_Q16[idx + 1];
+    return (msb << 16) + y0 + (((y1 - y0) * rem) >> (16 - LOG2_LUT_BITS));
+}
 
-            processed_blocks[block_idx].frames[frame_idx].start_time = current_time;
-            current_time += 20;  // 20ms帧移
+/*
+ * 帧能量（分贝）：以1个量化单位的有效值为0dB，即 10*log10(平方和/帧长)。
+ * 原先按参考声压换算后的结果与此相同（p_ref在比值中约掉），这里全程整数：
+ * riscv_power_q15求64位平方和，log2查表换算成分贝，不再有逐采样的double运算和sqrt/log10。
+ */
+int calculate_frame_energy(const int16_t* frame, int frame_length) {
+    q63_t square_sum;
+    riscv_power_q15(frame, frame_length, &square_sum);
+    // 平方和不足1（静音帧）时按1计算，结果约为-26dB，远低于门限
+    int32_t log2_mean_q16 = log2_q16((uint64_t)square_sum) - log2_q16((uint64_t)frame_length);
+    return (int)(((int64_t)log2_mean_q16 * DB_PER_LOG2_Q16) / ((int64_t)1 << 32));
+}
+
+/*
+ * 第二级，自适应VAD：固定40dB门限下采样直流偏置和底噪几乎让所有帧都判为语音，改为跟踪噪声底。
+ * 噪声底按最小值统计：每VAD_SUBWIN_FRAMES帧一个子窗口，取当前及最近VAD_SUBWINS个子窗口能量的最小值，
+ * 一直说话时噪声底在3秒内跟上，安静后立即回落。通过第一级且能量高出噪声底VAD_SNR_DB即为语音候选，
+ * 连续VAD_ONSET_FRAMES帧候选才进入语音段，候选结束后再保持VAD_HANGOVER_FRAMES帧，避免切掉词尾和弱辅音。
+ * 与训练端python代码/dataloader0.py的AdaptiveVAD一致。
+ */
+#define VAD_SUBWIN_FRAMES    25     // 子窗口长度（帧），0.5秒
+#define VAD_SNR_DB           10     // 语音判决信噪比（相对最小值，约比平均底噪高6dB）
+#define VAD_ONSET_FRAMES     3      // 起始确认帧数
+#define VAD_HANGOVER_FRAMES  10     // 拖尾帧数，200ms
+#define VAD_MIN_SPEECH_PCT   25     // 块内语音帧占比低于此值（%）时不打分，直接判为非目标说话人
+
+void vad_init(VadState* vad) {
+    for (int j = 0; j < VAD_SUBWINS; j++) {
+        vad->sub_min[j] = INT16_MAX;
+    }
+    vad->cur_min = INT16_MAX;
+    vad->sub_frames = 0;
+    vad->sub_idx = 0;
+    vad->onset = 0;
+    vad->hangover = 0;
+    vad->active = 0;
+    vad->noise_floor = INT16_MAX;
+}
+
+// 输入一帧能量（分贝）和第一级门限结果，返回该帧是否为语音；未通过第一级的帧只用于跟踪噪声底
+int vad_update(VadState* vad, int energy, int gate) {
+    int16_t e = (int16_t)energy;
+    if (e < vad->cur_min) {
+        vad->cur_min = e;
+    }
+    int16_t floor = vad->cur_min;
+    for (int j = 0; j < VAD_SUBWINS; j++) {
+        if (vad->sub_min[j] < floor) floor = vad->sub_min[j];
+    }
+    vad->noise_floor = floor;
+    if (++vad->sub_frames == VAD_SUBWIN_FRAMES) {
+        vad->sub_min[vad->sub_idx] = vad->cur_min;
+        vad->sub_idx = (vad->sub_idx + 1) % VAD_SUBWINS;
+        vad->cur_min = INT16_MAX;
+        vad->sub_frames = 0;
+    }
+
+    if (gate && energy >= floor + VAD_SNR_DB) {
+        if (vad->onset < VAD_ONSET_FRAMES) vad->onset++;
+        if (vad->onset >= VAD_ONSET_FRAMES) {
+            vad->active = 1;
+            vad->hangover = VAD_HANGOVER_FRAMES;
+        }
+    } else {
+        vad->onset = 0;
+        if (vad->hangover > 0) {
+            vad->hangover--;
+        } else {
+            vad->active = 0;
         }
     }
+    return vad->active && gate;
 }
 
-//实现能量阈值法：将帧数据转化为分贝，小于四十的删除，保存原顺序
+/*
+ * 过零次数：以帧均值为零点（去掉直流偏置），越过±GATE_ZCR_DEADZONE才算换号（施密特触发），
+ * 底噪的小幅抖动不计为过零。只有整数比较，在采集路径上逐帧计算。
+ */
+#define GATE_MIN_DB          20                     // 绝对能量门限，数字静音时不因噪声底极低而误判
+#define GATE_ZCR_DEADZONE    64                     // 约-54dBFS
+#define GATE_ZCR_RATE        3000                   // 每秒过零次数上限（主频约1.5kHz），超过视为宽带噪声或清擦音
+#define GATE_ZCR_MAX         (mfcc_rate->frame_len * GATE_ZCR_RATE / mfcc_rate->sample_rate)   // 8kHz下每帧150次
+
+int calculate_frame_zcr(const int16_t* frame, int frame_length) {
+    q15_t mean;
+    riscv_mean_q15(frame, frame_length, &mean);
+    int hi = mean + GATE_ZCR_DEADZONE;
+    int lo = mean - GATE_ZCR_DEADZONE;
+    int sign = 0;            // 1-正，-1-负，0-尚未越过死区
+    int crossings = 0;
+    for (int i = 0; i < frame_length; i++) {
+        if (frame[i] > hi) {
+            crossings += (sign < 0);
+            sign = 1;
+        } else if (frame[i] < lo) {
+            crossings += (sign > 0);
+            sign = -1;
+        }
+    }
+    return crossings;
+}
 
+/*
+ * 第一级预门限：能量低于绝对门限、未高出VAD已跟踪到的噪声底，或过零率过高的帧直接跳过，
+ * 不进入VAD的语音段判决，也不做加窗和FFT。先看已算好的能量，只有能量够的帧才计算过零率。
+ * 语音段内（含拖尾）不比较噪声底，否则拖尾帧都会在这里被拒绝。
+ */
+static int pre_gate(const VadState* vad, const int16_t* frame, int energy) {
+    if (energy < GATE_MIN_DB || (!vad->active && energy < vad->noise_floor + VAD_SNR_DB)) {
+        return 0;
+    }
+    return calculate_frame_zcr(frame, mfcc_rate->frame_len) <= (int)GATE_ZCR_MAX;
+}
 
-int calculate_frame_energy(uint16_t* frame, int frame_length) {
-    const double p_ref = 20e-6;     // 参考声压 (20微帕)
-    const double max_quant = 32768.0; // 16位量化最大值 (2^(16-1))
+static void gate_stats_count(int block, int gate, int is_speech) {
+    GateStats* st = &features.gate_stats[block];
+    st->frames++;
+    if (!gate) {
+        st->gate_skipped++;
+    } else if (!is_speech) {
+        st->vad_skipped++;
+    }
+}
 
-    // 1. 计算满量程声压
-    const double p_max = p_ref * max_quant;
+static void gate_stats_log(int block) {
+#if GATE_STATS_LOG
+    const GateStats* st = &features.gate_stats[block];
+    printf("  gate: %d frames, stage1 skip %d, vad skip %d, mfcc %d\n", st->frames, st->gate_skipped,
+           st->vad_skipped, st->frames - st->gate_skipped - st->vad_skipped);
+#endif
+}
 
-    // 2. 计算平方和（用于RMS）
-    double square_sum = 0.0;
-    for (int i = 0; i < frame_length; i++) {
-        // 归一化采样值
-        double normalized = (double)frame[i] / max_quant;
-        // 转换为声压值(Pa)
-        double p_sample = normalized * p_max;
-        // 累加平方值
-        square_sum += p_sample * p_sample;
+/*
+ * 块摘要：整块（1.5秒）去直流后的有效值低于BLOCK_SILENCE_RMS时整块判为静音，结果直接为0。
+ * 分块处理（dataloader）时静音块不再分帧、提取特征和打分，在大多数时间安静的场合省掉几乎全部计算；
+ * 流式路径每个PDM周期累计一次，块结束时才能判定，只省掉打分（见dataloader_stream）。
+ * 摘要只需和与平方和，代价约为逐帧求能量的一半（帧有重叠）。
+ */
+#define BLOCK_SILENCE_RMS    64     // 约36dB（-54dBFS），需低于正常说话时整块的有效值
+
+typedef struct {
+    int64_t sum;
+    int64_t sum_sq;
+    uint32_t count;
+} BlockSummary;
+
+// 累计n个采样
+static void block_summary_add(BlockSummary* bs, const int16_t* samples, uint32_t n) {
+    if (n == 0) {
+        return;
     }
+    q63_t power;
+    riscv_power_q15(samples, n, &power);    // 平方和（34.30，即整数平方和）
+    int32_t sum = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        sum += samples[i];
+    }
+    bs->sum += sum;
+    bs->sum_sq += power;
+    bs->count += n;
+}
 
-    // 3. 计算RMS声压
-    double p_rms = sqrt(square_sum / frame_length);
+static int block_summary_silent(const BlockSummary* bs) {
+    if (bs->count == 0) {
+        return 1;
+    }
+    int64_t mean = bs->sum / bs->count;
+    int64_t ac_power = bs->sum_sq / bs->count - mean * mean;   // 减去直流分量的功率
+    return ac_power < BLOCK_SILENCE_RMS * BLOCK_SILENCE_RMS;
+}
 
-    // 4. 避免对数计算错误（静音帧处理）
-    if (p_rms < 1e-20) p_rms = 1e-20;  // 安全阈值[8](@ref)
+static int block_is_silent(const int16_t* block) {
+    BlockSummary bs = { 0, 0, 0 };
+    block_summary_add(&bs, block, mfcc_rate->samples_per_block);
+    return block_summary_silent(&bs);
+}
 
-    // 5. 计算分贝值
-    int tmp = 20 * (log10(p_rms / p_ref));
-    return tmp;
+// 标记静音块，返回静音块数
+static int mark_silent_blocks(uint16_t** audio_blocks) {
+    int silent = 0;
+    for (int block_idx = 0; block_idx < TOTAL_BLOCKS; block_idx++) {
+        features.block_silent[block_idx] = (uint8_t)block_is_silent((const int16_t*)audio_blocks[block_idx]);
+        silent += features.block_silent[block_idx];
+    }
+    return silent;
 }
 
-// 主函数：计算所有帧的分贝值
+static VadState batch_vad;
+
+// 主函数：计算所有帧的分贝值并做VAD判决（每次处理6秒缓冲时重新跟踪噪声底）
 void cal_per_energy(uint16_t** audio_blocks, int num_frames, int frame_length) {
+    vad_init(&batch_vad);
     for (int block_idx = 0; block_idx < TOTAL_BLOCKS; block_idx++){
+        memset(&features.gate_stats[block_idx], 0, sizeof(GateStats));
+        if (features.block_silent[block_idx]) {
+            for (int i = 0; i < num_frames; i++) {
+                set_speech(block_idx * FRAMES_PER_BLOCK + i, 0);
+            }
+            continue;
+        }
         // 逐帧处理
         for (int i = 0; i < num_frames; i++) {
-            processed_blocks[block_idx].frames[i].energy = (int)calculate_frame_energy(processed_blocks[block_idx].frames[i].frame_data, frame_length);
-            if(processed_blocks[block_idx].frames[i].energy <= 40){
-                processed_blocks[block_idx].frames[i].is_speech = 0;
-            }else processed_blocks[block_idx].frames[i].is_speech = 1;
+            int frame = block_idx * FRAMES_PER_BLOCK + i;
+            const int16_t* samples = (const int16_t*)audio_blocks[block_idx] + i * mfcc_rate->frame_shift;
+            features.energy[frame] = (int16_t)calculate_frame_energy(samples, frame_length);
+            int gate = pre_gate(&batch_vad, samples, features.energy[frame]);
+            int is_speech = vad_update(&batch_vad, features.energy[frame], gate);
+            set_speech(frame, is_speech);
+            gate_stats_count(block_idx, gate, is_speech);
         }
 }
 }
 
 
 
+/*
+ * 加载时编译好的对角协方差GMM：逐帧打分只剩乘加，不再有logf和除法。
+ * 分量k的对数概率 = gconst[k] - 0.5 * Σ_d precisions[k][d] * (x[d] - means[k][d])^2
+ * （省略与模型无关的-0.5*D*log(2π)，求似然比时抵消）
+ * 参数的存放方式由GMM_LAYOUT在编译期选择（见algo.h），GMM_Model只包含所选布局的数组。
+ */
+#if GMM_LAYOUT != GMM_LAYOUT_COMPONENT && GMM_LAYOUT != GMM_LAYOUT_DIMENSION && GMM_LAYOUT != GMM_LAYOUT_Q15
+#error "GMM_LAYOUT只支持GMM_LAYOUT_COMPONENT、GMM_LAYOUT_DIMENSION和GMM_LAYOUT_Q15"
+#endif
+
+/*
+ * 按维度排列（GMM_LAYOUT_DIMENSION）：分量数补齐到GMM_LANES的整数倍，
+ * 对每一维d顺序扫过全部分量，N_COMPONENTS个累加器互不依赖，可按GMM_LANES路展开或向量化，
+ * 避免按分量存放时每个分量都是一条N_FEATURES长的串行归约。补齐的分量gconst为GMM_LOG_ZERO、缩放为0。
+ */
+#ifndef GMM_LANES
+#define GMM_LANES 4
+#endif
+#define GMM_COMP_PAD (((N_COMPONENTS) + GMM_LANES - 1) / GMM_LANES * GMM_LANES)
+
+/*
+ * Q15量化打分（GMM_LAYOUT_Q15）：分量对数概率展开为特征的二次式
+ *   gconst_k - 0.5*Σ_d mean_kd^2/var_kd + Σ_d (mean_kd/var_kd)*x_d + Σ_d (-0.5/var_kd)*x_d^2，
+ * 常数项留在浮点，其余是权重向量{mean/var, -0.5/var}与z = {x, x^2}的GMM_QDIM维点积。
+ * 权重按维度取绝对值最大值量化到Q15；z先乘同一维的权重尺度，再按整帧的绝对值最大值量化到Q15，
+ * 整数点积乘帧尺度即得浮点结果，每个分量只需一次点积和一次int64转float。
+ */
+#define GMM_QDIM (2 * N_FEATURES)
+#ifndef GMM_QUANT_TOL
+#define GMM_QUANT_TOL 0.05f     // 量化与浮点打分每帧平均似然比允许的最大偏差
+#endif
+
+// 按分量存放的浮点参数：按分量布局直接用于打分，Q15布局只在编入量化误差报告时作参考
+#define GMM_KEEP_F32 (GMM_LAYOUT == GMM_LAYOUT_COMPONENT || (GMM_LAYOUT == GMM_LAYOUT_Q15 && GMM_QUANT_REPORT))
 
 typedef struct {
-    float weights[N_COMPONENTS];
+#if GMM_KEEP_F32
+    float gconst[N_COMPONENTS];                   // log(w_k) - 0.5 * Σ_d log(var_kd)
     float means[N_COMPONENTS][N_FEATURES];
-    float covariances[N_COMPONENTS][N_FEATURES];
+    float precisions[N_COMPONENTS][N_FEATURES];   // 1 / var_kd
+#endif
+#if GMM_LAYOUT == GMM_LAYOUT_DIMENSION
+    float gconst_t[GMM_COMP_PAD];
+    float means_t[N_FEATURES][GMM_COMP_PAD];
+    float scales_t[N_FEATURES][GMM_COMP_PAD];     // -0.5 / var_kd，省去每帧的-0.5乘法
+#endif
+#if GMM_LAYOUT == GMM_LAYOUT_Q15
+    float gconst_q[N_COMPONENTS];                 // gconst_k - 0.5 * Σ_d mean_kd^2 / var_kd
+    float weight_scales[GMM_QDIM];                // 每维权重的绝对值最大值
+    q15_t weights_q[N_COMPONENTS][GMM_QDIM];      // {mean/var, -0.5/var} / weight_scales，Q15
+#endif
 } GMM_Model;
 
+#define GMM_VAR_FLOOR 1e-6f     // 与训练端GaussianMixture的reg_covar相同
+#define GMM_LOG_ZERO  -1e30f    // 权重为0的分量
+
 GMM_Model ubm;                 // UBM模型
 GMM_Model gmm_xiaoXin;         // 小新模型
 GMM_Model gmm_xiaoYuan;        // 小园模型
 
+// 读取第k个分量的权重、均值和方差（文件中依次为全部分量的权重、均值、方差），成功返回1
+static int gmm_read_component(FILE* file, int k, float* weight, float* mean, float* var) {
+    const long means_pos = (long)sizeof(float) * N_COMPONENTS;
+    const long vars_pos = means_pos + (long)sizeof(float) * N_COMPONENTS * N_FEATURES;
+    return fseek(file, (long)sizeof(float) * k, SEEK_SET) == 0 &&
+           fread(weight, sizeof(float), 1, file) == 1 &&
+           fseek(file, means_pos + (long)sizeof(float) * k * N_FEATURES, SEEK_SET) == 0 &&
+           fread(mean, sizeof(float), N_FEATURES, file) == N_FEATURES &&
+           fseek(file, vars_pos + (long)sizeof(float) * k * N_FEATURES, SEEK_SET) == 0 &&
+           fread(var, sizeof(float), N_FEATURES, file) == N_FEATURES;
+}
+
+// 把一个分量的权重和方差换算成打分常量（N_FEATURES次logf和除法）：方差原位换成精度，返回gconst
+static float gmm_compile_component(float weight, float* var) {
+    float log_det = 0.0f;
+    for (int d = 0; d < N_FEATURES; d++) {
+        float v = var[d] < GMM_VAR_FLOOR ? GMM_VAR_FLOOR : var[d];
+        log_det += logf(v);
+        var[d] = 1.0f / v;
+    }
+    return (weight > 0.0f ? logf(weight) : GMM_LOG_ZERO) - 0.5f * log_det;
+}
+
+#if GMM_LAYOUT == GMM_LAYOUT_Q15
+// 第j维的量化前权重：前N_FEATURES维为mean/var，后N_FEATURES维为-0.5/var
+static float gmm_q15_weight(int j, const float* mean, const float* prec) {
+    int d = j % N_FEATURES;
+    return j < N_FEATURES ? mean[d] * prec[d] : -0.5f * prec[d];
+}
+#endif
+
+// 逐分量读入并编译成所选布局，不需要整份浮点模型的中间缓冲区；
+// Q15布局先扫一遍全部分量得到每维的量化尺度，再读第二遍量化权重。失败返回-1
+static int gmm_load_components(FILE* file, GMM_Model* model) {
+    float weight, mean[N_FEATURES], prec[N_FEATURES];
+#if GMM_LAYOUT == GMM_LAYOUT_DIMENSION
+    for (int k = N_COMPONENTS; k < GMM_COMP_PAD; k++) {
+        model->gconst_t[k] = GMM_LOG_ZERO;
+        for (int d = 0; d < N_FEATURES; d++) {
+            model->means_t[d][k] = 0.0f;
+            model->scales_t[d][k] = 0.0f;
+        }
+    }
+#endif
+#if GMM_LAYOUT == GMM_LAYOUT_Q15
+    memset(model->weight_scales, 0, sizeof(model->weight_scales));
+#endif
+    for (int k = 0; k < N_COMPONENTS; k++) {
+        if (!gmm_read_component(file, k, &weight, mean, prec)) {
+            return -1;
+        }
+        float gconst = gmm_compile_component(weight, prec);
+#if GMM_KEEP_F32
+        model->gconst[k] = gconst;
+        memcpy(model->means[k], mean, sizeof(mean));
+        memcpy(model->precisions[k], prec, sizeof(prec));
+#endif
+#if GMM_LAYOUT == GMM_LAYOUT_DIMENSION
+        model->gconst_t[k] = gconst;
+        for (int d = 0; d < N_FEATURES; d++) {
+            model->means_t[d][k] = mean[d];
+            model->scales_t[d][k] = -0.5f * prec[d];
+        }
+#endif
+#if GMM_LAYOUT == GMM_LAYOUT_Q15
+        float bias = 0.0f;
+        for (int d = 0; d < N_FEATURES; d++) {
+            bias += mean[d] * mean[d] * prec[d];
+        }
+        model->gconst_q[k] = gconst - 0.5f * bias;
+        for (int j = 0; j < GMM_QDIM; j++) {
+            float w = fabsf(gmm_q15_weight(j, mean, prec));
+            if (w > model->weight_scales[j]) model->weight_scales[j] = w;
+        }
+#endif
+    }
+#if GMM_LAYOUT == GMM_LAYOUT_Q15
+    for (int k = 0; k < N_COMPONENTS; k++) {
+        float w[GMM_QDIM];
+        if (!gmm_read_component(file, k, &weight, mean, prec)) {
+            return -1;
+        }
+        gmm_compile_component(weight, prec);
+        for (int j = 0; j < GMM_QDIM; j++) {
+            w[j] = model->weight_scales[j] > 0.0f ? gmm_q15_weight(j, mean, prec) / model->weight_scales[j] : 0.0f;
+        }
+        riscv_float_to_q15(w, model->weights_q[k], GMM_QDIM);
+    }
+#endif
+    return 0;
+}
+
 void load_gmm_params(const char* path, GMM_Model* model) {
     FILE* file = fopen(path, "r");
     if (!file) {
         fprintf(stderr, "Error opening: %s\n", path);
         //exit(1);
+        return;
     }
 
-    fread(model->weights, sizeof(float), N_COMPONENTS, file);
-    for (int i = 0; i < N_COMPONENTS; i++) {
-        fread(model->means[i], sizeof(float), N_FEATURES, file);
-    }
-    for (int i = 0; i < N_COMPONENTS; i++) {
-        fread(model->covariances[i], sizeof(float), N_FEATURES, file);
+    // 文件没有头部，按分量数和特征维度（13/26/39）检查大小：权重 + 均值 + 协方差
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (size != (long)(sizeof(float) * N_COMPONENTS * (1 + 2 * N_FEATURES))) {
+        fprintf(stderr, "Model %s does not match N_COMPONENTS=%d N_FEATURES=%d\n", path, N_COMPONENTS, N_FEATURES);
+        fclose(file);
+        return;
     }
 
+    if (gmm_load_components(file, model) < 0) {
+        fprintf(stderr, "Error reading: %s\n", path);
+    }
     fclose(file);
 }
 
+// 按当前采样率配置的目录加载模型
 void init_models() {
-    load_gmm_params("models/ubm_params.bin", &ubm);
-    load_gmm_params("models/gmm_xiaoXin_params.bin", &gmm_xiaoXin);
-    load_gmm_params("models/gmm_xiaoYuan_params.bin", &gmm_xiaoYuan);
+    char path[64];
+    snprintf(path, sizeof(path), "%subm_params.bin", mfcc_rate->model_dir);
+    load_gmm_params(path, &ubm);
+    snprintf(path, sizeof(path), "%sgmm_xiaoXin_params.bin", mfcc_rate->model_dir);
+    load_gmm_params(path, &gmm_xiaoXin);
+    snprintf(path, sizeof(path), "%sgmm_xiaoYuan_params.bin", mfcc_rate->model_dir);
+    load_gmm_params(path, &gmm_xiaoYuan);
 }
 
-// 计算单高斯分量的对数概率密度
-float gaussian_log_prob(float* x, float* mean, float* covar, int dim) {
-    float log_prob = 0.0;
+// 计算单高斯分量的对数概率密度中与x有关的部分（不含gconst），内层只有乘加
+float gaussian_log_prob(const float* x, const float* mean, const float* prec, int dim) {
+    float dist = 0.0f;
     for (int d = 0; d < dim; d++) {
         float diff = x[d] - mean[d];
-        log_prob -= 0.5 * (diff * diff / covar[d] + logf(covar[d])); // 使用logf处理float
+        dist += prec[d] * diff * diff;
     }
-    return log_prob;
+    return -0.5f * dist;
 }
 
-// 计算GMM的对数似然
-int gmm_log_prob(GMM_Model* model, uint16_t* xx) {
-    float log_prob = -1e38; // 初始化为很小的数（log(0)=-inf）
-    float* x = (float*)xx;
-    for (int k = 0; k < N_COMPONENTS; k++) {
-        float comp_log_prob = logf(model->weights[k]) + // 使用logf处理float
-                             gaussian_log_prob(x, model->means[k], model->covariances[k], N_FEATURES);
+static GmmScoring gmm_scoring = GMM_SCORE_LOGSUMEXP;
+
+void gmm_set_scoring(GmmScoring mode) {
+    if (mode < GMM_SCORE_NUM) {
+        gmm_scoring = mode;
+    }
+}
+
+// 把n个分量的对数概率归约为对数似然
+static float gmm_reduce(const float* comp_log_prob, int n) {
+    if (gmm_scoring == GMM_SCORE_MAX_APPROX) {
+        // 近似：只取最大分量，比精确值低0~log(n)
+        float max_log_prob;
+        riscv_max_no_idx_f32(comp_log_prob, n, &max_log_prob);
+        return max_log_prob;
+    }
+    // log(Σ exp(l_k))，库函数先减去最大值再求指数，不会溢出
+    return riscv_logsumexp_f32(comp_log_prob, n);
+}
+
+// 分量对数概率的打分核：comps为NULL时计算全部分量（n为N_COMPONENTS），否则只计算列出的n个分量；
+// comp_log_prob需有GMM_COMP_PAD个元素
+typedef void (*GmmKernel)(const GMM_Model* model, const float* x, const uint8_t* comps, int n,
+                          float* comp_log_prob);
+
+#if GMM_KEEP_F32
+// 按分量存放的浮点参数
+static void gmm_log_probs_f32(const GMM_Model* model, const float* x, const uint8_t* comps, int n,
+                              float* comp_log_prob) {
+    for (int i = 0; i < n; i++) {
+        int k = comps ? comps[i] : i;
+        comp_log_prob[i] = model->gconst[k] +
+                           gaussian_log_prob(x, model->means[k], model->precisions[k], N_FEATURES);
+    }
+}
+#endif
+
+#if GMM_LAYOUT == GMM_LAYOUT_DIMENSION
+// 按维度排列的打分核：逐维把x[d]对全部分量的贡献累加到各自的累加器上，
+// 内层GMM_LANES个分量一组，组内互不依赖；只算列出的分量时按列（步长GMM_COMP_PAD）取参数，累加顺序相同
+static void gmm_log_probs_t(const GMM_Model* model, const float* x, const uint8_t* comps, int n,
+                            float* comp_log_prob) {
+    if (comps) {
+        for (int i = 0; i < n; i++) {
+            int k = comps[i];
+            float acc = model->gconst_t[k];
+            for (int d = 0; d < N_FEATURES; d++) {
+                float diff = x[d] - model->means_t[d][k];
+                acc += model->scales_t[d][k] * diff * diff;
+            }
+            comp_log_prob[i] = acc;
+        }
+        return;
+    }
+    memcpy(comp_log_prob, model->gconst_t, sizeof(model->gconst_t));
+    for (int d = 0; d < N_FEATURES; d++) {
+        const float xd = x[d];
+        const float* mean = model->means_t[d];
+        const float* scale = model->scales_t[d];
+        for (int k = 0; k < GMM_COMP_PAD; k += GMM_LANES) {
+            for (int l = 0; l < GMM_LANES; l++) {
+                float diff = xd - mean[k + l];
+                comp_log_prob[k + l] += scale[k + l] * diff * diff;
+            }
+        }
+    }
+}
+#endif
+
+#if GMM_LAYOUT == GMM_LAYOUT_Q15
+// 按模型的权重尺度把一帧特征量化为Q15的z = {x, x^2}，返回点积结果换算回浮点的系数
+static float gmm_quantise_frame(const GMM_Model* model, const float* x, q15_t* zq) {
+    float z[GMM_QDIM];
+    float amax = 0.0f;
+    for (int d = 0; d < N_FEATURES; d++) {
+        z[d] = x[d] * model->weight_scales[d];
+        z[N_FEATURES + d] = x[d] * x[d] * model->weight_scales[N_FEATURES + d];
+    }
+    for (int j = 0; j < GMM_QDIM; j++) {
+        if (fabsf(z[j]) > amax) amax = fabsf(z[j]);
+    }
+    if (amax == 0.0f) {
+        memset(zq, 0, GMM_QDIM * sizeof(q15_t));
+        return 0.0f;
+    }
+    riscv_scale_f32(z, 1.0f / amax, z, GMM_QDIM);
+    riscv_float_to_q15(z, zq, GMM_QDIM);
+    return amax / (32768.0f * 32768.0f);
+}
+
+/*
+ * Q15点积。P扩展下SMALDA每条指令做两路16x16乘法并累加到64位，不会饱和；
+ * KMADA只有32位饱和累加，满幅乘积最多容纳两项，GMM_QDIM项会溢出，因此不用。
+ */
+static int64_t gmm_dot_q15(const q15_t* w, const q15_t* z) {
+#if defined(RISCV_MATH_DSP)
+    int64_t acc = 0;
+    for (int j = 0; j < GMM_QDIM; j += 2) {
+        acc = __RV_SMALDA(acc, (unsigned long)read_q15x2(&w[j]), (unsigned long)read_q15x2(&z[j]));
+    }
+    return acc;
+#else
+    int64_t acc = 0;
+    for (int j = 0; j < GMM_QDIM; j++) {
+        acc += (int32_t)w[j] * z[j];
+    }
+    return acc;
+#endif
+}
+
+// 量化打分核
+static void gmm_log_probs_q15(const GMM_Model* model, const float* x, const uint8_t* comps, int n,
+                              float* comp_log_prob) {
+    q15_t zq[GMM_QDIM];
+    float scale = gmm_quantise_frame(model, x, zq);
+    for (int i = 0; i < n; i++) {
+        int k = comps ? comps[i] : i;
+        comp_log_prob[i] = model->gconst_q[k] + scale * (float)gmm_dot_q15(model->weights_q[k], zq);
+    }
+}
+#endif
+
+// 编译期所选布局的打分核
+#if GMM_LAYOUT == GMM_LAYOUT_DIMENSION
+#define GMM_KERNEL       gmm_log_probs_t
+#define GMM_LAYOUT_NAME  "dim-major"
+#elif GMM_LAYOUT == GMM_LAYOUT_Q15
+#define GMM_KERNEL       gmm_log_probs_q15
+#define GMM_LAYOUT_NAME  "q15"
+#else
+#define GMM_KERNEL       gmm_log_probs_f32
+#define GMM_LAYOUT_NAME  "comp-major"
+#endif
+
+// 计算GMM的对数似然：各分量的对数概率先算成向量，再整体归约
+float gmm_log_prob(const GMM_Model* model, const float* x) {
+    float comp_log_prob[GMM_COMP_PAD];
+    GMM_KERNEL(model, x, NULL, N_COMPONENTS, comp_log_prob);
+    return gmm_reduce(comp_log_prob, N_COMPONENTS);
+}
 
-        // LogSumExp算法（避免数值溢出）
-        if (comp_log_prob > log_prob) {
-            log_prob = comp_log_prob;
+/*
+ * Top-C快速打分（GMM-UBM）：说话人模型由UBM做MAP均值自适应得到，分量与UBM一一对应，
+ * 一帧特征的似然几乎全部来自UBM得分最高的少数几个分量。UBM完整计算后选出前top_c个分量，
+ * 说话人模型只计算这些分量，每个说话人的代价从N_COMPONENTS个分量降到top_c个，
+ * 增加注册说话人时每块的计算量基本不变。top_c为0或不小于N_COMPONENTS时退化为完整打分。
+ */
+
+// 选出得分最高的c个分量（插入排序，c很小）
+static int gmm_top_components(const float* comp_log_prob, int c, uint8_t* top) {
+    float top_score[N_COMPONENTS];
+    int count = 0;
+    for (int k = 0; k < N_COMPONENTS; k++) {
+        float score = comp_log_prob[k];
+        if (count == c && score <= top_score[c - 1]) {
+            continue;
+        }
+        int pos = count < c ? count++ : c - 1;
+        while (pos > 0 && top_score[pos - 1] < score) {
+            top_score[pos] = top_score[pos - 1];
+            top[pos] = top[pos - 1];
+            pos--;
         }
+        top_score[pos] = score;
+        top[pos] = (uint8_t)k;
     }
-    int result = (int)log_prob;
-    return result;
+    return count;
 }
 
-// 计算对数似然比
-void compute_llr(uint16_t** audio_blocks, int num_frames, int frame_length,uint8_t * result) {
+// 用打分核kernel计算一帧特征对两个说话人的对数似然比
+static void frame_llr(GmmKernel kernel, const float* x, int top_c, float* llr_xin, float* llr_yuan) {
+    float comp_log_prob[GMM_COMP_PAD];
+    kernel(&ubm, x, NULL, N_COMPONENTS, comp_log_prob);
+    float logp_ubm = gmm_reduce(comp_log_prob, N_COMPONENTS);
+    uint8_t top[N_COMPONENTS];
+    const uint8_t* comps = NULL;
+    int n = N_COMPONENTS;
+    if (top_c > 0 && top_c < N_COMPONENTS) {
+        n = gmm_top_components(comp_log_prob, top_c, top);
+        comps = top;
+    }
+    kernel(&gmm_xiaoXin, x, comps, n, comp_log_prob);
+    *llr_xin = gmm_reduce(comp_log_prob, n) - logp_ubm;
+    kernel(&gmm_xiaoYuan, x, comps, n, comp_log_prob);
+    *llr_yuan = gmm_reduce(comp_log_prob, n) - logp_ubm;
+}
+
+// 由每帧平均似然比判决：0-非目标说话人，1-小新，2-小园
+static uint8_t llr_decide(float mean_llr_xin, float mean_llr_yuan) {
+    if (mean_llr_xin < 0.5f && mean_llr_yuan < 0.5f) return 0;
+    return mean_llr_xin > mean_llr_yuan ? 1 : 2;
+}
+
+// 对一块打分：num_frames帧中有speech_frames帧语音，特征从first_frame起紧凑存放
+// 返回0-非目标说话人，1-小新，2-小园；语音太少时不做GMM计算，直接返回0
+static uint8_t score_block(int first_frame, int num_frames, int speech_frames) {
+    if (speech_frames * 100 < num_frames * VAD_MIN_SPEECH_PCT) {
+        return 0;
+    }
     float sum_llr_xin = 0.0;
     float sum_llr_yuan = 0.0;
-    for (int block_idx = 0; block_idx < TOTAL_BLOCKS; block_idx++){
-        for (int i = 0; i < num_frames; i++) {
-            if(processed_blocks[block_idx].frames->is_speech == 0){
-                continue;
+    for (int i = first_frame; i < first_frame + speech_frames; i++) {
+        float llr_xin, llr_yuan;
+        frame_llr(GMM_KERNEL, features.mfcc[i], GMM_TOP_C, &llr_xin, &llr_yuan);
+        sum_llr_xin += llr_xin;
+        sum_llr_yuan += llr_yuan;
+    }
+    // 按语音帧数平均，结果不再随块内静音的长短变化
+    return llr_decide(sum_llr_xin / speech_frames, sum_llr_yuan / speech_frames);
+}
+
+#if GMM_LAYOUT == GMM_LAYOUT_Q15 && GMM_QUANT_REPORT
+/*
+ * 量化误差报告：num_frames帧特征（每帧N_FEATURES维，紧凑存放）分别按浮点参考参数和Q15打分，
+ * 打印UBM分量对数概率和每帧似然比的最大误差、两种打分的平均似然比与判决（数值均乘1000）。
+ * 平均似然比偏差都不超过GMM_QUANT_TOL且判决一致时返回1，否则返回0。
+ */
+int gmm_quant_report(const float* x, int num_frames) {
+    if (num_frames <= 0) {
+        return 0;
+    }
+    float max_comp_err = 0.0f, max_llr_err = 0.0f;
+    float sum_f[2] = { 0.0f, 0.0f }, sum_q[2] = { 0.0f, 0.0f };
+    for (int i = 0; i < num_frames; i++) {
+        const float* xi = x + i * N_FEATURES;
+        float comp_f[GMM_COMP_PAD], comp_q[GMM_COMP_PAD];
+        float llr_f[2], llr_q[2];
+        gmm_log_probs_f32(&ubm, xi, NULL, N_COMPONENTS, comp_f);
+        gmm_log_probs_q15(&ubm, xi, NULL, N_COMPONENTS, comp_q);
+        frame_llr(gmm_log_probs_f32, xi, GMM_TOP_C, &llr_f[0], &llr_f[1]);
+        frame_llr(gmm_log_probs_q15, xi, GMM_TOP_C, &llr_q[0], &llr_q[1]);
+        for (int k = 0; k < N_COMPONENTS; k++) {
+            float err = fabsf(comp_f[k] - comp_q[k]);
+            if (err > max_comp_err) max_comp_err = err;
+        }
+        for (int m = 0; m < 2; m++) {
+            float err = fabsf(llr_f[m] - llr_q[m]);
+            if (err > max_llr_err) max_llr_err = err;
+            sum_f[m] += llr_f[m];
+            sum_q[m] += llr_q[m];
+        }
+    }
+
+    float mean_f[2], mean_q[2];
+    for (int m = 0; m < 2; m++) {
+        mean_f[m] = sum_f[m] / num_frames;
+        mean_q[m] = sum_q[m] / num_frames;
+    }
+    uint8_t decision_f = llr_decide(mean_f[0], mean_f[1]);
+    uint8_t decision_q = llr_decide(mean_q[0], mean_q[1]);
+    int ok = fabsf(mean_f[0] - mean_q[0]) <= GMM_QUANT_TOL &&
+             fabsf(mean_f[1] - mean_q[1]) <= GMM_QUANT_TOL && decision_f == decision_q;
+    printf("gmm q15 report: %d frames, max comp err*1000=%ld, max frame llr err*1000=%ld\n",
+           num_frames, (long)(max_comp_err * 1000), (long)(max_llr_err * 1000));
+    printf("gmm q15 report: mean llr*1000 float=%ld/%ld q15=%ld/%ld, decision float=%d q15=%d, %s\n",
+           (long)(mean_f[0] * 1000), (long)(mean_f[1] * 1000), (long)(mean_q[0] * 1000), (long)(mean_q[1] * 1000),
+           decision_f, decision_q, ok ? "within tolerance" : "OUT OF TOLERANCE");
+    return ok;
+}
+#endif
+
+#if ALGO_BENCHMARK
+// 用同一帧特征对比GMM打分方式（精确/近似归约 x 完整/Top-C）的每帧耗时（周期数，三个模型合计）和似然比，
+// 参数布局为编译期所选的GMM_LAYOUT，对比布局需分别编译
+void gmm_benchmark_scoring(const float* x, int loops) {
+    GmmScoring saved = gmm_scoring;
+    static const int top_c[2] = { N_COMPONENTS, GMM_TOP_C };
+    for (int mode = 0; mode < GMM_SCORE_NUM; mode++) {
+        gmm_set_scoring((GmmScoring)mode);
+        for (int t = 0; t < 2; t++) {
+            float llr_xin = 0.0f, llr_yuan = 0.0f;
+            uint64_t start = __get_rv_cycle();
+            for (int n = 0; n < loops; n++) {
+                frame_llr(GMM_KERNEL, x, top_c[t], &llr_xin, &llr_yuan);
             }
-            uint16_t* frame = (uint16_t*)(processed_blocks[block_idx].frames->mfcc);
-            int logp_ubm = gmm_log_prob(&ubm, frame);
-            int logp_xin = gmm_log_prob(&gmm_xiaoXin, frame);
-            int logp_yuan = gmm_log_prob(&gmm_xiaoYuan, frame);
-            sum_llr_xin += (logp_xin - logp_ubm);
-            sum_llr_yuan += (logp_yuan - logp_ubm);
-            if(sum_llr_xin / num_frames < 0.5 && sum_llr_yuan / num_frames < 0.5) result[block_idx] = 0;
-            result[i] = (sum_llr_xin / num_frames) > (sum_llr_yuan / num_frames)? 1 : 2;
+            uint64_t cycles = __get_rv_cycle() - start;
+            printf("gmm scoring %s %s top%d: %lu cycles/frame, llr*1000=%ld/%ld\n", GMM_LAYOUT_NAME,
+                   mode == GMM_SCORE_LOGSUMEXP ? "logsumexp" : "max(approx)", top_c[t],
+                   (unsigned long)(cycles / loops), (long)(llr_xin * 1000), (long)(llr_yuan * 1000));
         }
     }
+    gmm_scoring = saved;
 }
+#endif
 
-//实现将帧数据转化为mfcc特征
-void frames_to_mfcc(uint16_t** audio_blocks, int num_frames, int frame_length){
+// 计算对数似然比
+void compute_llr(uint16_t** audio_blocks, int num_frames, int frame_length,uint8_t * result) {
     for (int block_idx = 0; block_idx < TOTAL_BLOCKS; block_idx++){
-        // 逐帧处理
-        for (int i = 0; i < num_frames; i++) {
-            for(int j = 0;j < 400;++j){
-                processed_blocks[block_idx].frames[i].frame_data[j] = (short)(3000 * sin(2 * PI * 1000 * j / 8000) +
-                               2000 * sin(2 * PI * 3000 * j / 8000));
-            }
-            float sample = 8000.0;
-            compute_mfcc(processed_blocks[block_idx].frames[i].frame_data,processed_blocks[block_idx].frames[i].mfcc,sample);
+        if (features.block_silent[block_idx]) {
+            result[block_idx] = 0;
+            continue;
         }
+        result[block_idx] = score_block(block_idx * FRAMES_PER_BLOCK, num_frames, features.speech_frames[block_idx]);
     }
 }
 
+/*
+ * 滑动倒谱均值方差归一化：指数加权的均值和方差，每帧O(N_MFCC)更新，不缓存历史帧。
+ * 权重取1/(n+1)，前CMVN_WINDOW帧等价于累计平均，之后固定为1/CMVN_WINDOW（指数遗忘）。
+ * 只有语音帧提取特征，统计量也只由语音帧更新，与训练端python代码/dataloader0.py的RunningCMVN一致。
+ */
+#if CMVN_ENABLE
+typedef struct {
+    float mean[N_MFCC];
+    float var[N_MFCC];
+    uint32_t count;          // 已统计的帧数，达到CMVN_WINDOW - 1后不再增加
+} CmvnState;
 
-// 预加重系数
-static const float PREEMPHASIS_ALPHA = 0.97f;
-// 汉明窗系数（400点）
-static float HAMMING_WINDOW[FRAME_LEN];
-
-// 初始化汉明窗（只需调用一次）
-void init_hamming_window() {
-    for (int i = 0; i < FRAME_LEN; i++) {
-        HAMMING_WINDOW[i] = 0.54f - 0.46f * cos(2 * PI * i / (FRAME_LEN - 1));
-    }
-}
-
-// 快速傅里叶变换（基2算法）
-void fft(float* x_real, float* x_imag, int n) {
-    int i, j, k, m;
-    float t_real, t_imag, u_real, u_imag, w_real, w_imag;
-
-    // 位反转重排
-    j = 0;
-    for (i = 0; i < n - 1; i++) {
-        if (i < j) {
-            t_real = x_real[i];
-            t_imag = x_imag[i];
-            x_real[i] = x_real[j];
-            x_imag[i] = x_imag[j];
-            x_real[j] = t_real;
-            x_imag[j] = t_imag;
-        }
-        k = n / 2;
-        while (k <= j) {
-            j -= k;
-            k /= 2;
-        }
-        j += k;
-    }
-
-    // 蝶形运算
-    for (m = 2; m <= n; m *= 2) {
-        float angle = -2 * PI / m;
-        w_real = cos(angle);
-        w_imag = sin(angle);
-
-        for (k = 0; k < n; k += m) {
-            u_real = 1.0f;
-            u_imag = 0.0f;
-
-            for (j = 0; j < m / 2; j++) {
-                int idx1 = k + j;
-                int idx2 = idx1 + m / 2;
-
-                // 蝶形计算
-                t_real = x_real[idx2] * u_real - x_imag[idx2] * u_imag;
-                t_imag = x_real[idx2] * u_imag + x_imag[idx2] * u_real;
-
-                x_real[idx2] = x_real[idx1] - t_real;
-                x_imag[idx2] = x_imag[idx1] - t_imag;
-                x_real[idx1] = x_real[idx1] + t_real;
-                x_imag[idx1] = x_imag[idx1] + t_imag;
-
-                // 更新旋转因子
-                float next_u_real = u_real * w_real - u_imag * w_imag;
-                u_imag = u_real * w_imag + u_imag * w_real;
-                u_real = next_u_real;
-            }
+#define CMVN_VAR_FLOOR 1e-2f
+
+static CmvnState cmvn_state;
+
+// 原位归一化一帧，update非0时先用该帧更新统计量
+static void cmvn_apply(CmvnState* state, float* mfcc, int update) {
+    float w = 1.0f / (state->count + 1);
+    if (update && state->count + 1 < CMVN_WINDOW) {
+        state->count++;
+    }
+    for (int d = 0; d < N_MFCC; d++) {
+        if (update) {
+            float diff = mfcc[d] - state->mean[d];
+            state->mean[d] += w * diff;
+            state->var[d] = (1.0f - w) * (state->var[d] + w * diff * diff);
         }
+        float var = state->var[d] > CMVN_VAR_FLOOR ? state->var[d] : CMVN_VAR_FLOOR;
+        mfcc[d] = (mfcc[d] - state->mean[d]) / sqrtf(var);
     }
 }
+#endif
 
-// 创建梅尔滤波器组
-void create_mel_filters(float sample_rate, float** filters) {
-    const float min_mel = 0.0f;
-    const float max_mel = 2595.0f * log10f(1.0f + (sample_rate / 2) / 700.0f);
+/*
+ * 差分特征：回归差分 d(t) = sum_k k*(c(t+k) - c(t-k)) / (2*sum_k k^2)，k = 1..DELTA_WINDOW。
+ * 静态倒谱和一阶差分各保存在2*DELTA_WINDOW+1帧的环形历史中，每帧只算一次，代价O(N_FEATURES)。
+ * 差分需要后续帧，完整特征比输入晚DELTA_LAG帧输出；序列开头复制首帧，结尾用delta_flush复制末帧补齐。
+ */
+#define DELTA_WINDOW 2
+#define DELTA_SPAN   (2 * DELTA_WINDOW + 1)
+#define DELTA_LAG    (DELTA_WINDOW * DELTA_ORDER)
+#define DELTA_DENOM  10.0f      // 2 * (1^2 + 2^2)
 
-    // 在梅尔刻度上均匀分布的频率点
-    float mel_points[MEL_FILTERS + 2];
-    for (int i = 0; i < MEL_FILTERS + 2; i++) {
-        mel_points[i] = min_mel + (max_mel - min_mel) * i / (MEL_FILTERS + 1);
+typedef struct {
+    float ceps[DELTA_SPAN][N_MFCC];     // 静态倒谱历史，第n帧在n % DELTA_SPAN
+    float delta[DELTA_SPAN][N_MFCC];    // 一阶差分历史
+    uint32_t count;                     // 已推入的帧数
+} DeltaState;
+
+static void delta_reset(DeltaState* st) {
+    st->count = 0;
+}
+
+#if DELTA_ORDER >= 1
+// 在历史hist中计算第t帧的回归差分
+static void delta_regress(float hist[DELTA_SPAN][N_MFCC], int32_t t, float* out) {
+    for (int d = 0; d < N_MFCC; d++) {
+        float acc = 0.0f;
+        for (int k = 1; k <= DELTA_WINDOW; k++) {
+            acc += k * (hist[(t + k) % DELTA_SPAN][d] - hist[(t - k + DELTA_SPAN) % DELTA_SPAN][d]);
+        }
+        out[d] = acc / DELTA_DENOM;
+    }
+}
+#endif
+
+// 推入一帧静态倒谱；有输出时把第count-DELTA_LAG帧的N_FEATURES维特征写入out并返回1
+static int delta_push(DeltaState* st, const float* ceps, float* out) {
+    int32_t n = (int32_t)st->count++;
+    memcpy(st->ceps[n % DELTA_SPAN], ceps, sizeof(st->ceps[0]));
+    if (n == 0) {
+        // 开头之前的帧视为与首帧相同
+        for (int j = 1; j < DELTA_SPAN; j++) {
+            memcpy(st->ceps[j], ceps, sizeof(st->ceps[0]));
+        }
     }
 
-    // 将梅尔频率转换为Hz
-    float hz_points[MEL_FILTERS + 2];
-    for (int i = 0; i < MEL_FILTERS + 2; i++) {
-        hz_points[i] = 700.0f * (powf(10.0f, mel_points[i] / 2595.0f) - 1.0f);
+#if DELTA_ORDER >= 1
+    int32_t td = n - DELTA_WINDOW;    // 本次可计算一阶差分的帧
+    if (td >= 0) {
+        delta_regress(st->ceps, td, st->delta[td % DELTA_SPAN]);
+        if (td == 0) {
+            for (int j = 1; j < DELTA_SPAN; j++) {
+                memcpy(st->delta[j], st->delta[0], sizeof(st->delta[0]));
+            }
+        }
+    }
+#endif
+    int32_t t = n - DELTA_LAG;        // 本次输出的帧
+    if (t < 0) {
+        return 0;
     }
+    memcpy(out, st->ceps[t % DELTA_SPAN], N_MFCC * sizeof(float));
+#if DELTA_ORDER >= 1
+    memcpy(out + N_MFCC, st->delta[t % DELTA_SPAN], N_MFCC * sizeof(float));
+#endif
+#if DELTA_ORDER >= 2
+    delta_regress(st->delta, t, out + 2 * N_MFCC);
+#endif
+    return 1;
+}
 
-    // 转换为FFT bin索引
-    int bin_indices[MEL_FILTERS + 2];
-    for (int i = 0; i < MEL_FILTERS + 2; i++) {
-        bin_indices[i] = floorf((FFT_LEN + 1) * hz_points[i] / sample_rate);
+// 序列结束：复制末帧推入，输出剩余的一帧，返回0表示已全部输出
+static int delta_flush(DeltaState* st, uint32_t frames_in, float* out) {
+    if (st->count >= frames_in + DELTA_LAG || st->count == 0) {
+        return 0;
     }
+    float last[N_MFCC];
+    memcpy(last, st->ceps[(frames_in - 1) % DELTA_SPAN], sizeof(last));
+    return delta_push(st, last, out);
+}
 
-    // 构建三角形滤波器
-    for (int m = 1; m <= MEL_FILTERS; m++) {
-        for (int k = 0; k <= FFT_LEN / 2; k++) {
-            if (k < bin_indices[m - 1]) {
-                filters[m - 1][k] = 0.0f;
-            } else if (k <= bin_indices[m]) {
-                if (bin_indices[m] != bin_indices[m - 1]) {
-                    filters[m - 1][k] = (float)(k - bin_indices[m - 1]) /
-                                        (bin_indices[m] - bin_indices[m - 1]);
-                }
-            } else if (k <= bin_indices[m + 1]) {
-                if (bin_indices[m + 1] != bin_indices[m]) {
-                    filters[m - 1][k] = (float)(bin_indices[m + 1] - k) /
-                                        (bin_indices[m + 1] - bin_indices[m]);
+//实现将帧数据转化为mfcc特征
+void frames_to_mfcc(uint16_t** audio_blocks, int num_frames, int frame_length){
+    static DeltaState delta_state;
+    for (int block_idx = 0; block_idx < TOTAL_BLOCKS; block_idx++){
+        int first_frame = block_idx * FRAMES_PER_BLOCK;
+        int out_frame = first_frame;
+        uint32_t speech_frames = 0;
+        if (features.block_silent[block_idx]) {
+            features.speech_frames[block_idx] = 0;
+            continue;
+        }
+        delta_reset(&delta_state);
+        // 非语音帧跳过，语音帧每MFCC_BATCH_MAX帧一批提取；每块的语音帧连成一个序列单独计算差分
+        int i = 0;
+        while (i < num_frames) {
+            const int16_t* batch[MFCC_BATCH_MAX];
+            float ceps[MFCC_BATCH_MAX][N_MFCC];
+            int n = 0;
+            for (; i < num_frames && n < MFCC_BATCH_MAX; i++) {
+                if (frame_is_speech(first_frame + i)) {
+                    batch[n++] = (const int16_t*)audio_blocks[block_idx] + i * mfcc_rate->frame_shift;
                 }
-            } else {
-                filters[m - 1][k] = 0.0f;
+            }
+            mfcc_process_batch(batch, n, &ceps[0][0]);
+            for (int k = 0; k < n; k++) {
+#if CMVN_ENABLE
+                cmvn_apply(&cmvn_state, ceps[k], 1);
+#endif
+                speech_frames++;
+                out_frame += delta_push(&delta_state, ceps[k], features.mfcc[out_frame]);
             }
         }
+        while (delta_flush(&delta_state, speech_frames, features.mfcc[out_frame])) {
+            out_frame++;
+        }
+        features.speech_frames[block_idx] = (uint8_t)speech_frames;
     }
 }
 
-// 主MFCC计算函数
-void compute_mfcc(uint16_t* input_frame, uint16_t* mfcc_out, float sample_rate) {
-    // 0. 初始化汉明窗（只需一次）
-    static int window_initialized = 0;
-    if (!window_initialized) {
-        init_hamming_window();
-        window_initialized = 1;
+// 预加重系数
+static const float PREEMPHASIS_ALPHA = 0.97f;
+#define PREEMPHASIS_ALPHA_Q15 31785    // 0.97 * 2^15
+#define PREEMPHASIS_ALPHA_HALF_Q15 15892  // 0.97 / 2 * 2^15（预加重结果带1位余量）
+
+#if !MFCC_FRONTEND_Q15
+// DCT-II基矩阵（N_MFCC x MEL_FILTERS，已包含正交归一化因子），来自mfcc_tables.h，各采样率共用
+static const riscv_matrix_instance_f32 dct_matrix_f32 = {
+    N_MFCC, MEL_FILTERS, (float32_t*)MFCC_DCT_COEFS_F32
+};
+#endif
+// 转置基矩阵（MEL_FILTERS x N_MFCC），用于多帧批量DCT
+static const riscv_matrix_instance_f32 dct_matrix_t_f32 = {
+    MEL_FILTERS, N_MFCC, (float32_t*)MFCC_DCT_COEFS_T_F32
+};
+
+// 批量DCT：log_energies为[num_frames][MEL_FILTERS]，mfcc_out为[num_frames][N_MFCC]
+// 一次riscv_mat_mult_f32完成多帧，基矩阵只加载一遍
+void mfcc_dct_batch(const float* log_energies, int num_frames, float* mfcc_out) {
+    riscv_matrix_instance_f32 src = { (uint16_t)num_frames, MEL_FILTERS, (float32_t*)log_energies };
+    riscv_matrix_instance_f32 dst = { (uint16_t)num_frames, N_MFCC, mfcc_out };
+    riscv_mat_mult_f32(&src, &dct_matrix_t_f32, &dst);
+}
+
+#if MFCC_FRONTEND_Q15
+/*
+ * 定点MFCC前端：
+ * 输入为有符号16位PCM，FFT为Q15，功率谱为Q30，梅尔累加为64位，
+ * 对数通过log2查表得到Q8.7格式，输出倒谱为Q8.7格式（与浮点前端量纲一致）
+ */
+#define LN2_Q16                45426    // ln(2) * 2^16
+#define LOG_ENERGY_FRAC        7        // 对数梅尔能量Q8.7
+#define MFCC_Q15_FRAC          7        // 输出倒谱Q8.7（Q15基矩阵乘Q8.7向量，结果仍为Q8.7）
+
+static const riscv_matrix_instance_q15 dct_matrix_q15 = {
+    N_MFCC, MEL_FILTERS, (q15_t*)MFCC_DCT_COEFS_Q15
+};
+#endif /* MFCC_FRONTEND_Q15 */
+
+/*
+ * NMSIS-DSP自带的riscv_mfcc_f32/riscv_mfcc_q15后端，滤波器、DCT和窗系数来自离线生成的mfcc_tables.h。
+ * 厂商实现在梅尔滤波前取的是幅度谱而不是功率谱，并且按帧峰值归一化，
+ * 这里把输出乘2换算到对数功率的量纲，但c0仍不含帧的绝对电平，倒谱与模型不匹配，只用于性能对比。
+ */
+static float nmsis_frame_f32[MFCC_MAX_FFT_LEN];          // 输入帧（riscv_mfcc_f32会原位修改）
+static float nmsis_tmp_f32[MFCC_MAX_FFT_LEN + 2];
+static q15_t nmsis_frame_q15[MFCC_MAX_FFT_LEN];
+static q31_t nmsis_tmp_q15[2 * MFCC_MAX_FFT_LEN];
+
+/*
+ * 前端的FFT缓冲区（4KB）放在静态区，不占调用者（算法任务）的栈，各采样率、逐帧和批量前端共用，
+ * 浮点与Q15前端不会同时运行，共用同一块内存。前端只在算法任务中调用，不可重入。
+ */
+static union {
+    struct {
+        float in[MFCC_MAX_FFT_LEN];             // FFT输入（补零到FFT点数）
+        float out[MFCC_MAX_FFT_LEN];            // FFT输出（打包的复数频谱）
+    } f32;
+    struct {
+        q15_t in[MFCC_MAX_FFT_LEN];
+        union {
+            q15_t fft_out[2 * MFCC_MAX_FFT_LEN];    // riscv_rfft_q15输出完整的复数频谱
+            uint32_t power[MFCC_MAX_FFT_LEN];       // 原位计算的Q30功率谱
+        } spectrum;
+    } q15;
+} mfcc_scratch;
+
+#if !MFCC_FRONTEND_Q15
+// 浮点批量前端的中间结果（约9KB），各采样率共用；逐帧前端的功率谱用第0帧的位置。Q15前端不需要
+static float mfcc_batch_power[MFCC_BATCH_MAX][MFCC_MAX_FFT_LEN / 2 + 1];
+static float mfcc_batch_log[MFCC_BATCH_MAX][MEL_FILTERS];
+#endif
+
+// 每种采样率各实例化一份前端内核（预加重/加窗、FFT、梅尔滤波、三种后端），见mfcc_kernel.h
+#define MK(name)        name##_8k
+#define MK_TABLE(name)  MFCC8K_##name
+#include "mfcc_kernel.h"
+
+#if MFCC_RATE_16K
+#define MK(name)        name##_16k
+#define MK_TABLE(name)  MFCC16K_##name
+#include "mfcc_kernel.h"
+#endif
+
+static const MfccRateConfig mfcc_rates[] = {
+    { MFCC8K_SAMPLE_RATE, MFCC8K_FRAME_LEN, MFCC8K_FRAME_SHIFT, MFCC8K_SAMPLE_RATE * 3 / 2,
+      mfcc_backends_8k, MFCC8K_HPF_COEFS_F32, "models/" },
+#if MFCC_RATE_16K
+    { MFCC16K_SAMPLE_RATE, MFCC16K_FRAME_LEN, MFCC16K_FRAME_SHIFT, MFCC16K_SAMPLE_RATE * 3 / 2,
+      mfcc_backends_16k, MFCC16K_HPF_COEFS_F32, "models/16k/" },
+#endif
+};
+
+static const MfccRateConfig* mfcc_rate = &mfcc_rates[0];
+// 打分路径固定用自带前端：NMSIS后端按帧峰值归一化并对幅度谱滤波，倒谱c0丢失绝对电平，
+// 与按自带前端特征训练的模型不匹配，只在mfcc_benchmark_backends中做性能对比
+static const MfccBackend* mfcc_backend = &mfcc_backends_8k[MFCC_BACKEND_NATIVE];
+
+// 批量提取n帧的MFCC：frames[i]指向第i帧起点（帧可以相互重叠），mfcc_out为[n][N_MFCC]
+// 每MFCC_BATCH_MAX帧一批交给后端的批量实现，没有批量实现的后端（包括MFCC_FRONTEND_Q15时的自带前端）逐帧计算
+void mfcc_process_batch(const int16_t* const* frames, int n, float* mfcc_out) {
+    while (n > 0) {
+        int len = n < MFCC_BATCH_MAX ? n : MFCC_BATCH_MAX;
+        if (mfcc_backend->compute_batch) {
+            mfcc_backend->compute_batch(frames, len, mfcc_out);
+        } else {
+            for (int i = 0; i < len; i++) {
+                mfcc_backend->compute(frames[i], mfcc_out + i * N_MFCC);
+            }
+        }
+        frames += len;
+        mfcc_out += len * N_MFCC;
+        n -= len;
     }
+}
 
-    float preemph_frame[FRAME_LEN];      // 预加重后的帧
-    float windowed_frame[FRAME_LEN];     // 加窗后的帧
-    float fft_real[FFT_LEN] = {0};       // FFT实部
-    float fft_imag[FFT_LEN] = {0};       // FFT虚部
-    float power_spectrum[FFT_LEN / 2 + 1]; // 功率谱
+static void capture_highpass_reset(void);
 
-    // 1. 预加重处理
-    preemph_frame[0] = (float)input_frame[0];
-    for (int i = 1; i < FRAME_LEN; i++) {
-        preemph_frame[i] = (float)input_frame[i] -
-                           PREEMPHASIS_ALPHA * input_frame[i - 1];
+// 按采集采样率（抽取后）选择特征配置，须在开始采集前调用；不支持的采样率返回-1，保持原配置
+int mfcc_select_rate(uint32_t sample_rate) {
+    for (uint32_t i = 0; i < sizeof(mfcc_rates) / sizeof(mfcc_rates[0]); i++) {
+        if (mfcc_rates[i].sample_rate == sample_rate) {
+            mfcc_rate = &mfcc_rates[i];
+            mfcc_backend = &mfcc_rate->backends[MFCC_BACKEND_NATIVE];
+            capture_highpass_reset();
+            return 0;
+        }
     }
+    return -1;
+}
 
-    // 2. 应用汉明窗
-    for (int i = 0; i < FRAME_LEN; i++) {
-        windowed_frame[i] = preemph_frame[i] * HAMMING_WINDOW[i];
+#if ALGO_BENCHMARK
+// 用同一帧数据对比当前采样率下各后端每帧耗时（周期数），不影响特征提取使用的后端
+void mfcc_benchmark_backends(const int16_t* frame, int loops) {
+    float mfcc[N_MFCC];
+    for (int id = 0; id < MFCC_BACKEND_NUM; id++) {
+        const MfccBackend* backend = &mfcc_rate->backends[id];
+        if (backend->init) {
+            backend->init();
+        }
+        backend->compute(frame, mfcc);    // 首次调用包含表初始化，不计时
+        uint64_t start = __get_rv_cycle();
+        for (int n = 0; n < loops; n++) {
+            backend->compute(frame, mfcc);
+        }
+        uint64_t cycles = __get_rv_cycle() - start;
+        printf("mfcc backend %s: %lu cycles/frame, c0=%d\n", backend->name,
+               (unsigned long)(cycles / loops), (int)mfcc[0]);
+        if (backend->compute_batch) {
+            // 同一帧重复MFCC_BATCH_MAX次组成一批，与逐帧调用对比
+            const int16_t* batch[MFCC_BATCH_MAX];
+            float batch_mfcc[MFCC_BATCH_MAX][N_MFCC];
+            for (int i = 0; i < MFCC_BATCH_MAX; i++) {
+                batch[i] = frame;
+            }
+            start = __get_rv_cycle();
+            for (int n = 0; n < loops; n++) {
+                backend->compute_batch(batch, MFCC_BATCH_MAX, &batch_mfcc[0][0]);
+            }
+            cycles = __get_rv_cycle() - start;
+            printf("mfcc backend %s batch x%d: %lu cycles/frame\n", backend->name, MFCC_BATCH_MAX,
+                   (unsigned long)(cycles / ((uint64_t)loops * MFCC_BATCH_MAX)));
+        }
+    }
+}
+#endif
+
+
+// ---------------- 采集抽取（PDM高采样率 -> 特征采样率） ----------------
+// PDM采样率高于特征采样率（mfcc_select_rate选定的8k/16kHz）时，算法任务每个周期把新采样经抗混叠FIR抽取下来（倍数2/4/6），
+// 多相滤波状态保存在NMSIS实例中跨周期延续。系数见mfcc_tables.h，阶数为24*倍数，每个输出采样24*倍数次乘加。
+#define DECIM_MAX_RATIO   6
+#define DECIM_OUT_BLOCK   80     // 每次调用NMSIS输出的采样数
+#define DECIM_MAX_TAPS    (MFCC_TABLE_DECIM_TAPS_PER_RATIO * DECIM_MAX_RATIO)
+
+static riscv_fir_decimate_instance_q15 capture_decim;
+static q15_t capture_decim_state[DECIM_MAX_TAPS + DECIM_OUT_BLOCK * DECIM_MAX_RATIO - 1];
+static uint32_t capture_decim_ratio = 1;
+
+// 按PDM采样率in_rate初始化抽取器（输出为当前特征采样率，须在mfcc_select_rate之后调用），
+// 返回抽取倍数，不支持的采样率返回-1。系数按倍数归一化设计，对各特征采样率通用
+int capture_decimate_init(uint32_t in_rate) {
+    const q15_t* taps;
+    if (in_rate % mfcc_rate->sample_rate) {
+        return -1;
     }
+    switch (in_rate / mfcc_rate->sample_rate) {
+    case 1: taps = NULL;                 break;
+    case 2: taps = MFCC_DECIM2_TAPS_Q15; break;
+    case 4: taps = MFCC_DECIM4_TAPS_Q15; break;
+    case 6: taps = MFCC_DECIM6_TAPS_Q15; break;
+    default:
+        return -1;
+    }
+    capture_decim_ratio = in_rate / mfcc_rate->sample_rate;
+    if (taps) {
+        riscv_fir_decimate_init_q15(&capture_decim, MFCC_TABLE_DECIM_TAPS_PER_RATIO * capture_decim_ratio,
+                                    capture_decim_ratio, taps, capture_decim_state,
+                                    DECIM_OUT_BLOCK * capture_decim_ratio);
+    }
+    return capture_decim_ratio;
+}
 
-    // 3. 准备FFT输入（补零）
-    for (int i = 0; i < FRAME_LEN; i++) {
-        fft_real[i] = windowed_frame[i];
+/*
+ * PDM环形缓冲区raw（raw_len个采样，须为抽取倍数的整数倍）从raw_offset起新写入n个采样，
+ * 抽取后写入采集环形缓冲区ring的ring_offset处（处理回绕）。只处理n中抽取倍数的整数倍部分，
+ * 余下的采样留到下个周期；返回输出的采样数，调用者的raw读位置前移“输出数*倍数”。
+ */
+uint32_t capture_decimate(const int16_t* raw, uint32_t raw_len, uint32_t raw_offset, uint32_t n,
+                          int16_t* ring, uint32_t ring_len, uint32_t ring_offset) {
+    static q15_t out[DECIM_OUT_BLOCK];
+    uint32_t produced = 0;
+    n -= n % capture_decim_ratio;
+    while (n > 0) {
+        raw_offset %= raw_len;
+        uint32_t len = DECIM_OUT_BLOCK * capture_decim_ratio;
+        if (len > n) len = n;
+        if (len > raw_len - raw_offset) len = raw_len - raw_offset;
+        uint32_t out_len = len / capture_decim_ratio;
+
+        if (capture_decim_ratio == 1) {
+            memcpy(out, raw + raw_offset, len * sizeof(q15_t));
+        } else {
+#if defined(RISCV_MATH_DSP)
+            // 系数直流增益为1，32位累加不会溢出
+            riscv_fir_decimate_fast_q15(&capture_decim, raw + raw_offset, out, len);
+#else
+            riscv_fir_decimate_q15(&capture_decim, raw + raw_offset, out, len);
+#endif
+        }
+
+        uint32_t pos = (ring_offset + produced) % ring_len;
+        uint32_t head = (pos + out_len <= ring_len) ? out_len : ring_len - pos;
+        memcpy(ring + pos, out, head * sizeof(int16_t));
+        memcpy(ring, out + head, (out_len - head) * sizeof(int16_t));
+
+        produced += out_len;
+        raw_offset += len;
+        n -= len;
     }
+    return produced;
+}
 
-    // 4. 执行FFT
-    fft(fft_real, fft_imag, FFT_LEN);
 
-    // 5. 计算功率谱（取前257点）
-    for(int i = 0; i <= FFT_LEN / 2; i++){
-        power_spectrum[i] = (fft_real[i] * fft_real[i] +
-                            fft_imag[i] * fft_imag[i]) / FFT_LEN;
+// ---------------- 采集高通（去直流） ----------------
+// PDM采样带直流偏置，会抬高帧能量、干扰VAD并污染c0。每个PDM周期在分帧前对新采样原位做二阶巴特沃斯高通
+// （截止60Hz，系数见mfcc_tables.h，随特征采样率选择），滤波器状态跨周期保存；每采样5次乘加，远低于1%的CPU。
+// 用单精度DF2T而不用df1_q15：截止频率低时极点贴近单位圆，Q15截断误差经反馈放大约500倍，输出残留上百的直流。
+#define HPF_CHUNK 160            // 每次转换成浮点处理的采样数
+
+typedef struct {
+    riscv_biquad_cascade_df2T_instance_f32 inst;
+    float32_t state[2];
+    int primed;
+} HighpassState;
+
+static HighpassState capture_hpf;
+static int capture_hpf_ready;
+
+static void highpass_init(HighpassState* hp, const float32_t* coefs) {
+    riscv_biquad_cascade_df2T_init_f32(&hp->inst, 1, coefs, hp->state);
+    hp->primed = 0;
+}
+
+static void highpass_run(HighpassState* hp, int16_t* samples, uint32_t n) {
+    static float32_t buf[HPF_CHUNK];
+    if (n == 0) {
+        return;
     }
+    if (!hp->primed) {
+        // 以首个采样作为此前的稳态输入（高通输出为0），避免开机时直流阶跃产生的冲击
+        float32_t x0 = samples[0] / 32768.0f;
+        hp->state[0] = -hp->inst.pCoeffs[0] * x0;
+        hp->state[1] = hp->inst.pCoeffs[2] * x0;
+        hp->primed = 1;
+    }
+    while (n > 0) {
+        uint32_t len = n < HPF_CHUNK ? n : HPF_CHUNK;
+        riscv_q15_to_float(samples, buf, len);
+        riscv_biquad_cascade_df2T_f32(&hp->inst, buf, buf, len);
+        riscv_float_to_q15(buf, samples, len);
+        samples += len;
+        n -= len;
+    }
+}
 
-    // 6. 创建梅尔滤波器组
-    float** mel_filters = (float**)osal_malloc(MEL_FILTERS * sizeof(float*));
-    for(int i = 0; i < MEL_FILTERS; i++){
-        mel_filters[i] = (float*)osal_malloc((FFT_LEN / 2 + 1 )*sizeof(float));
+// 采集缓冲区ring（ring_len个采样）中从offset开始新写入了n个采样，原位滤波（处理回绕）
+// PDM数据为16位补码，uint16_t缓冲区按int16_t传入即可
+void capture_highpass(int16_t* ring, uint32_t ring_len, uint32_t offset, uint32_t n) {
+    if (!capture_hpf_ready) {
+        highpass_init(&capture_hpf, mfcc_rate->hpf_coefs);
+        capture_hpf_ready = 1;
     }
-    create_mel_filters(sample_rate, mel_filters);
+    offset %= ring_len;
+    uint32_t head = (offset + n <= ring_len) ? n : ring_len - offset;
+    highpass_run(&capture_hpf, ring + offset, head);
+    highpass_run(&capture_hpf, ring, n - head);
+}
+
+// 切换采样率后按新系数重新初始化
+static void capture_highpass_reset(void) {
+    capture_hpf_ready = 0;
+}
+
 
-    // 7. 应用梅尔滤波器组
-    float filter_energies[MEL_FILTERS] = {0};
-    for(int m = 0; m < MEL_FILTERS; m++){
-        for (int k = 0; k <= FFT_LEN / 2; k++) {
-            filter_energies[m] += power_spectrum[k] * mel_filters[m][k];
+// ---------------- 流式MFCC提取 ----------------
+// PDM每个中断周期推入新采样，特征计算分摊到各个周期，不再等6秒缓冲满后集中处理
+// 帧长和帧移取初始化时的采样率配置（mfcc_select_rate须先调用）
+
+void mfcc_stream_init(MfccStream* stream, const int16_t* ring, uint32_t ring_len,
+                      MfccFrameCallback cb, void* cb_ctx) {
+    stream->ring = ring;
+    stream->ring_len = ring_len;
+    stream->next_offset = 0;
+    stream->available = 0;
+    stream->frame_index = 0;
+    stream->frame_len = mfcc_rate->frame_len;
+    stream->frame_shift = mfcc_rate->frame_shift;
+    stream->block_hops = 0;
+    stream->block_frames = 0;
+    vad_init(&stream->vad);
+    stream->cb = cb;
+    stream->cb_ctx = cb_ctx;
+}
+
+// 环形缓冲区新写入n个采样（长度任意），每凑满一帧输出一帧特征，返回本次输出的帧数
+// 设置了block_hops时，块内第block_frames帧之后的帧移直接跳过，不计算能量、VAD和特征，也不回调
+int mfcc_stream_push(MfccStream* stream, uint32_t n) {
+    int emitted = 0;
+    stream->available += n;
+    while (stream->available >= stream->frame_len) {
+        if (stream->block_hops && stream->frame_index % stream->block_hops >= stream->block_frames) {
+            stream->frame_index++;
+            stream->next_offset = (stream->next_offset + stream->frame_shift) % stream->ring_len;
+            stream->available -= stream->frame_shift;
+            continue;
+        }
+        const int16_t* samples = ring_frame(stream->ring, stream->ring_len, stream->next_offset,
+                                            stream->frame_len, stream->scratch);
+
+        MfccFrame frame;
+        frame.index = stream->frame_index++;
+        frame.offset = stream->next_offset;
+        frame.energy = calculate_frame_energy(samples, stream->frame_len);
+        frame.gate = pre_gate(&stream->vad, samples, frame.energy);
+        frame.is_speech = vad_update(&stream->vad, frame.energy, frame.gate);
+        if (frame.is_speech) {
+            mfcc_backend->compute(samples, frame.mfcc);   // 非语音帧不提取特征
+        }
+        if (stream->cb) {
+            stream->cb(&frame, stream->cb_ctx);
         }
-        // 避免log(0)
-        if (filter_energies[m] < 1e-10) filter_energies[m] = 1e-10;
+        emitted++;
+
+        stream->next_offset = (stream->next_offset + stream->frame_shift) % stream->ring_len;
+        stream->available -= stream->frame_shift;
     }
+    return emitted;
+}
+
+static MfccStream speaker_stream;
+
+static DeltaState stream_delta;
+static uint32_t stream_speech_frames;   // 当前块已推入差分历史的语音帧数
+static int stream_out_frame;            // 当前块下一个特征的存放位置
 
-    // 8. 取对数
-    float log_energies[MEL_FILTERS];
-    for(int m = 0; m < MEL_FILTERS; m++){
-        log_energies[m] = logf(filter_energies[m]);
+// 打印一块的结果（块序号从0计，每块1.5秒）
+static void stream_block_result(uint32_t block, uint8_t result) {
+    printf("%lu.%lus~%lu.%lus:%d\n",
+           (unsigned long)(block * 3 / 2), (unsigned long)(block % 2 * 5),
+           (unsigned long)((block + 1) * 3 / 2), (unsigned long)((block + 1) % 2 * 5), result);
+    gate_stats_log(block % TOTAL_BLOCKS);
+}
+
+/*
+ * 流式特征回调：提取器只输出每块（75个帧移）的前72帧，分块方式与dataloader和训练端相同，
+ * 差分在块内的语音帧序列上计算，块末复制末帧补齐，做法与frames_to_mfcc相同。
+ * VAD的输入与训练端AudioProcessor处理一段连续录音时一致：每块前72帧依次送入，静音块同样送入，
+ * 噪声底和拖尾状态跨块延续。dataloader每个6秒缓冲重新初始化VAD并跳过静音块，
+ * 缓冲开头和静音块之后的几帧判决可能与流式不同。
+ * 第72帧在块内最后一个采样到达之前就已完整，打分留到dataloader_stream拿到整块摘要之后
+ */
+static void speaker_stream_frame(const MfccFrame* frame, void* cb_ctx) {
+    uint32_t block = frame->index / HOPS_PER_BLOCK;
+    int i = frame->index % HOPS_PER_BLOCK;
+    int first_frame = (block % TOTAL_BLOCKS) * FRAMES_PER_BLOCK;
+    if (i == 0) {
+        delta_reset(&stream_delta);
+        stream_speech_frames = 0;
+        stream_out_frame = first_frame;
+        memset(&features.gate_stats[block % TOTAL_BLOCKS], 0, sizeof(GateStats));
+    }
+    features.energy[first_frame + i] = (int16_t)frame->energy;
+    set_speech(first_frame + i, frame->is_speech);
+    gate_stats_count(block % TOTAL_BLOCKS, frame->gate, frame->is_speech);
+
+    if (frame->is_speech) {
+        float ceps[N_MFCC];
+        memcpy(ceps, frame->mfcc, sizeof(ceps));
+#if CMVN_ENABLE
+        cmvn_apply(&cmvn_state, ceps, 1);
+#endif
+        stream_speech_frames++;
+        stream_out_frame += delta_push(&stream_delta, ceps, features.mfcc[stream_out_frame]);
     }
 
-    // 9. DCT变换获取MFCC系数
-    for (int i = 0; i < 13; i++) {
-        mfcc_out[i] = 0;
-        for (int m = 0; m < MEL_FILTERS; m++) {
-            mfcc_out[i] += log_energies[m] *
-                          cos(PI * i * (m + 0.5f) / MEL_FILTERS);
-        }
-        // 能量归一化因子
-        if (i == 0) {
-            mfcc_out[i] *= sqrtf(1.0 / MEL_FILTERS);
-        } else {
-            mfcc_out[i] *= sqrtf(2.0 / MEL_FILTERS);
+    if (i == FRAMES_PER_BLOCK - 1) {
+        while (delta_flush(&stream_delta, stream_speech_frames, features.mfcc[stream_out_frame])) {
+            stream_out_frame++;
         }
+        features.speech_frames[block % TOTAL_BLOCKS] = (uint8_t)stream_speech_frames;
     }
+}
 
-    // 10. 清理内存
-    for (int i = 0; i < MEL_FILTERS; i++) {
-    	osal_free(mel_filters[i]);
-    }
+#if ALGO_BENCHMARK || (GMM_LAYOUT == GMM_LAYOUT_Q15 && GMM_QUANT_REPORT)
+#define ALGO_BENCHMARK_LOOPS 100
 
-    //osal_free(mel_filters);
+// 性能对比和量化误差报告：第一个有语音帧的块打分后运行一次，输入为该块的一帧采样和块内语音帧特征
+static void stream_benchmark_once(const int16_t* frame, int first_frame, int speech_frames) {
+    static int done = 0;
+    if (done || speech_frames == 0) {
+        return;
+    }
+    done = 1;
+#if ALGO_BENCHMARK
+    mfcc_benchmark_backends(frame, ALGO_BENCHMARK_LOOPS);
+    gmm_benchmark_scoring(features.mfcc[first_frame], ALGO_BENCHMARK_LOOPS);
+#endif
+#if GMM_LAYOUT == GMM_LAYOUT_Q15 && GMM_QUANT_REPORT
+    gmm_quant_report(features.mfcc[first_frame], speech_frames);
+#endif
 }
+#endif
 
+static BlockSummary stream_summary;     // 当前块已到达采样的摘要
+static uint32_t stream_block;           // 当前块序号
+static uint32_t stream_block_fill;      // 当前块已到达的采样数
+static uint32_t stream_ring_offset;     // 下一个新采样在环形缓冲区中的位置
+
+/*
+ * 流式处理入口：采集环形缓冲区ring（ring_len个采样）中新写入了n个采样。
+ * 新采样立即交给流式提取器逐帧处理，特征计算仍分摊到各个PDM周期，环形缓冲区只需容纳一帧加上一个周期的新采样；
+ * 同时累计块摘要，块内最后一个采样到达时（块的前72帧此时都已提取完）再按摘要决定：
+ * 静音块丢弃已收集的帧，直接判0，省掉GMM打分；否则对块内语音帧打分。
+ * 整块摘要要等块结束才能得到，静音块中VAD判为语音的帧仍会提取MFCC（静音块中这类帧很少）。
+ */
+void dataloader_stream(const int16_t* ring, uint32_t ring_len, uint32_t n){
+    static int initialized = 0;
+    if (!initialized) {
+        init_models();
+        mfcc_stream_init(&speaker_stream, ring, ring_len, speaker_stream_frame, NULL);
+        speaker_stream.block_hops = HOPS_PER_BLOCK;     // 块间多出的3个帧移不成帧
+        speaker_stream.block_frames = FRAMES_PER_BLOCK;
+        initialized = 1;
+    }
+    while (n > 0) {
+        uint32_t block_len = mfcc_rate->samples_per_block;
+        uint32_t len = block_len - stream_block_fill;
+        if (len > n) len = n;
+        uint32_t head = (stream_ring_offset + len <= ring_len) ? len : ring_len - stream_ring_offset;
+        block_summary_add(&stream_summary, ring + stream_ring_offset, head);
+        block_summary_add(&stream_summary, ring, len - head);
+        stream_ring_offset = (stream_ring_offset + len) % ring_len;
+        stream_block_fill += len;
+        n -= len;
+        mfcc_stream_push(&speaker_stream, len);
+
+        if (stream_block_fill == block_len) {
+            int b = stream_block % TOTAL_BLOCKS;
+            features.block_silent[b] = (uint8_t)block_summary_silent(&stream_summary);
+            if (features.block_silent[b]) {
+                features.speech_frames[b] = 0;
+                stream_block_result(stream_block, 0);
+            } else {
+                stream_block_result(stream_block, score_block(b * FRAMES_PER_BLOCK, FRAMES_PER_BLOCK, features.speech_frames[b]));
+#if ALGO_BENCHMARK || (GMM_LAYOUT == GMM_LAYOUT_Q15 && GMM_QUANT_REPORT)
+                // 块内最后一帧（第72帧）的起点在块尾之前，仍在环形缓冲区中
+                static int16_t bench_scratch[MFCC_MAX_FRAME_LEN];
+                uint32_t back = block_len - (FRAMES_PER_BLOCK - 1) * mfcc_rate->frame_shift;
+                const int16_t* frame = ring_frame(ring, ring_len, stream_ring_offset + ring_len - back,
+                                                  mfcc_rate->frame_len, bench_scratch);
+                stream_benchmark_once(frame, b * FRAMES_PER_BLOCK, features.speech_frames[b]);
+#endif
+            }
+            memset(&stream_summary, 0, sizeof(stream_summary));
+            stream_block++;
+            stream_block_fill = 0;
+        }
+    }
+}
 
 
 void dataloader(uint16_t* raw_data){
 	if(*raw_data == 65535) return;
-	init_models();
 	split_audio_into_blocks(raw_data);
-    split_into_frames(audio_blocks);
-    cal_per_energy(audio_blocks,72,400);
-    frames_to_mfcc(audio_blocks,72,400);
-    uint8_t result[4];
-    compute_llr(audio_blocks,72,400,result);
+    uint8_t result[4] = {0};
+    // 静音块直接判0；6秒全部静音时连模型都不加载，立即返回让CPU休眠
+    if (mark_silent_blocks(audio_blocks) < TOTAL_BLOCKS) {
+        init_models();
+        cal_per_energy(audio_blocks,FRAMES_PER_BLOCK,mfcc_rate->frame_len);
+        frames_to_mfcc(audio_blocks,FRAMES_PER_BLOCK,mfcc_rate->frame_len);
+        compute_llr(audio_blocks,FRAMES_PER_BLOCK,mfcc_rate->frame_len,result);
+    }
     printf("0s~1.5s:%d\n",result[0]);
+    gate_stats_log(0);
     printf("1.5s~3s:%d\n",result[1]);
+    gate_stats_log(1);
     printf("3s~4.5s:%d\n",result[2]);
+    gate_stats_log(2);
     printf("4.5s~6s:%d\n",result[3]);
+    gate_stats_log(3);
 }
 //uint16_t test = 65535;
 //dataloader(&test);
@@ -7,9 +7,126 @@
 
 #ifndef GALAXY_SDK_ALGO_H_
 #define GALAXY_SDK_ALGO_H_
+#include <stdint.h>
+
+// 特征采样率：8kHz始终可用；MFCC_RATE_16K为1时同时编入16kHz宽带配置（帧长32ms，梅尔范围100~7600Hz），
+// 由mfcc_select_rate按采集采样率选择。两种配置的帧移都是20ms，帧参数见mfcc_tables.h
+#ifndef MFCC_RATE_16K
+#define MFCC_RATE_16K 1
+#endif
+#define MFCC_MAX_FRAME_LEN 512   // 各采样率帧长的最大值
+// mfcc_process_batch每批处理的帧数（4~8），越大表和旋转因子的复用越充分，中间缓冲区每帧约1.2KB
+#ifndef MFCC_BATCH_MAX
+#define MFCC_BATCH_MAX 8
+#endif
+#define N_MFCC 13           // 静态MFCC维数
+// 差分特征阶数：0-仅静态倒谱（13维），1-加一阶差分（26维），2-再加二阶差分（39维）
+#ifndef DELTA_ORDER
+#define DELTA_ORDER 0
+#endif
+#define N_FEATURES (N_MFCC * (DELTA_ORDER + 1))   // GMM特征维度
+
+// MFCC特征提取后端（特征提取固定用自带前端，NMSIS后端只在mfcc_benchmark_backends中对比性能）
+typedef enum {
+    MFCC_BACKEND_NATIVE = 0,   // algo.c自带前端（浮点或Q15，见MFCC_FRONTEND_Q15）
+    MFCC_BACKEND_NMSIS_F32,    // NMSIS-DSP riscv_mfcc_f32
+    MFCC_BACKEND_NMSIS_Q15,    // NMSIS-DSP riscv_mfcc_q15
+    MFCC_BACKEND_NUM
+} MfccBackendId;
+
+// GMM打分方式
+typedef enum {
+    GMM_SCORE_LOGSUMEXP = 0,   // 精确：对全部分量做log-sum-exp（默认）
+    GMM_SCORE_MAX_APPROX,      // 近似：只取最大分量，省去64次exp，得分偏低且似然比噪声更大
+    GMM_SCORE_NUM
+} GmmScoring;
+
+// GMM参数的内存布局（编译期选择，模型只保留所选布局的参数）。
+// 一次编译只有一种布局，gmm_benchmark_scoring只测所编入的布局，对比各布局的耗时需用不同的GMM_LAYOUT分别编译
+#define GMM_LAYOUT_COMPONENT 0   // 按分量存放means[k][d]，内层是N_FEATURES维的短归约
+#define GMM_LAYOUT_DIMENSION 1   // 按维度存放means[d][k]，内层对所有分量逐元素并行累加
+#define GMM_LAYOUT_Q15       2   // 按分量存放的Q15量化参数，打分为[x, x^2]与权重的16位点积，参数约为浮点的一半
+#ifndef GMM_LAYOUT
+#define GMM_LAYOUT GMM_LAYOUT_COMPONENT
+#endif
+// Q15布局下编入量化误差报告gmm_quant_report（需额外保留一份按分量存放的浮点参数作参考）
+#ifndef GMM_QUANT_REPORT
+#define GMM_QUANT_REPORT 0
+#endif
+// 性能对比：1时编入mfcc_benchmark_backends和gmm_benchmark_scoring，流式路径第一个有语音的块打分后各运行一次
+// （量化误差报告同样在这时运行）。运行期间采集缓冲区会被覆盖，只用于测量，正式固件保持0
+#ifndef ALGO_BENCHMARK
+#define ALGO_BENCHMARK 0
+#endif
+
+// 自适应语音活动检测：最小值统计跟踪噪声底，按信噪比判决，起始确认加拖尾平滑
+#define VAD_SUBWINS 6            // 噪声底取最近6个子窗口（共3秒）能量的最小值
+typedef struct {
+    int16_t sub_min[VAD_SUBWINS];   // 已结束子窗口的最小能量（分贝）
+    int16_t cur_min;                // 当前子窗口的最小能量
+    uint8_t sub_frames;             // 当前子窗口已统计的帧数
+    uint8_t sub_idx;                // 下一个写入的子窗口
+    uint8_t onset;                  // 连续超过门限的帧数
+    uint8_t hangover;               // 剩余拖尾帧数
+    uint8_t active;                 // 当前是否处于语音段
+    int16_t noise_floor;            // 当前噪声底（分贝）
+} VadState;
+
+// 流式提取输出的一帧特征
+typedef struct {
+    uint32_t index;              // 帧序号（从mfcc_stream_init开始计数）
+    uint32_t offset;             // 帧起点在采集缓冲区中的采样偏移
+    int energy;                  // 分贝
+    int gate;                    // 第一级预门限（能量/过零率）是否通过
+    int is_speech;               // VAD判决
+    float mfcc[N_MFCC];          // 静态倒谱，仅在is_speech非0时计算
+} MfccFrame;
+
+typedef void (*MfccFrameCallback)(const MfccFrame* frame, void* cb_ctx);
+
+// 流式MFCC提取器：直接在采集环形缓冲区上取帧（零拷贝），每凑满一个帧移输出一帧特征
+typedef struct {
+    const int16_t* ring;         // 采集环形缓冲区
+    uint32_t ring_len;           // 环形缓冲区长度（采样）
+    uint32_t next_offset;        // 下一帧起点在缓冲区中的偏移
+    uint32_t available;          // 从下一帧起点起已写入的采样数
+    uint32_t frame_index;        // 下一帧的序号
+    uint16_t frame_len;          // 帧长（采样）
+    uint16_t frame_shift;        // 帧移（采样）
+    uint16_t block_hops;         // 每block_hops个帧移只取前block_frames帧，其余帧移不成帧；0为逐帧全取
+    uint16_t block_frames;
+    VadState vad;
+    int16_t scratch[MFCC_MAX_FRAME_LEN];  // 仅在帧跨越缓冲区末尾时拼接使用
+    MfccFrameCallback cb;
+    void* cb_ctx;
+} MfccStream;
+
 void dataloader(uint16_t* raw_data);
-void frames_to_mfcc(uint8_t** audio_blocks, int num_frames, int frame_length);
+void frames_to_mfcc(uint16_t** audio_blocks, int num_frames, int frame_length);
 //void compute_mfcc(uint16_t* input_frame, uint16_t* mfcc_out, float sample_rate);
+void mfcc_dct_batch(const float* log_energies, int num_frames, float* mfcc_out);
+void mfcc_process_batch(const int16_t* const* frames, int n, float* mfcc_out);
+int mfcc_select_rate(uint32_t sample_rate);
+#if ALGO_BENCHMARK
+void mfcc_benchmark_backends(const int16_t* frame, int loops);
+#endif
+void gmm_set_scoring(GmmScoring mode);
+#if GMM_LAYOUT == GMM_LAYOUT_Q15 && GMM_QUANT_REPORT
+int gmm_quant_report(const float* x, int num_frames);
+#endif
+#if ALGO_BENCHMARK
+void gmm_benchmark_scoring(const float* x, int loops);
+#endif
+void vad_init(VadState* vad);
+int vad_update(VadState* vad, int energy, int gate);
+int capture_decimate_init(uint32_t in_rate);
+uint32_t capture_decimate(const int16_t* raw, uint32_t raw_len, uint32_t raw_offset, uint32_t n,
+                          int16_t* ring, uint32_t ring_len, uint32_t ring_offset);
+void capture_highpass(int16_t* ring, uint32_t ring_len, uint32_t offset, uint32_t n);
+void mfcc_stream_init(MfccStream* stream, const int16_t* ring, uint32_t ring_len,
+                      MfccFrameCallback cb, void* cb_ctx);
+int mfcc_stream_push(MfccStream* stream, uint32_t n);
+void dataloader_stream(const int16_t* ring, uint32_t ring_len, uint32_t n);
 
 
 #endif /* GALAXY_SDK_ALGO_H_ */
@@ -52,11 +52,45 @@
 #define BUF_SIZE 1024
 //static int buf_pool[2][BUF_SIZE];
 //static int battery = 100;//电量
- uint16_t pdm_buf[48000];//6秒的数据
-static volatile int total_bytes = 0;
+// 特征采样率：8000（窄带）或16000（宽带，需MFCC_RATE_16K），模型需按同一采样率训练
+#ifndef ALGO_SAMPLE_RATE
+#define ALGO_SAMPLE_RATE 8000
+#endif
+#if ALGO_SAMPLE_RATE != 8000 && !(ALGO_SAMPLE_RATE == 16000 && MFCC_RATE_16K)
+#error "ALGO_SAMPLE_RATE只支持8000，或在MFCC_RATE_16K开启时支持16000"
+#endif
+// 采集环形缓冲区：实时路径是流式处理（EVENT_AUD_PCM_DATA），新采样每个周期即时成帧，
+// 只需容纳一帧（最长64ms）加上算法任务一次处理期间PDM继续写入的采样，最长的一次是块末的GMM打分；
+// 与dataloader按6秒分块的布局无关（16kHz时6秒要192KB）
+#ifndef PDM_RING_MS
+#define PDM_RING_MS 1000
+#endif
+#if PDM_RING_MS < 500
+#error "PDM_RING_MS至少为500（一帧加上块末打分期间的余量）"
+#endif
+ uint16_t pdm_buf[PDM_RING_MS * (ALGO_SAMPLE_RATE / 1000)];
+#define PDM_BUF_SAMPLES (int)(sizeof(pdm_buf) / sizeof(pdm_buf[0]))
+// PDM采样率：等于ALGO_SAMPLE_RATE时直接写入pdm_buf；为其2/4/6倍（其他模块需要）时写入pdm_raw_buf，
+// 算法任务每个周期抽取到ALGO_SAMPLE_RATE后写入pdm_buf
+#ifndef PDM_CAPTURE_RATE
+#define PDM_CAPTURE_RATE ALGO_SAMPLE_RATE
+#endif
+#define PDM_DECIM_RATIO (PDM_CAPTURE_RATE / ALGO_SAMPLE_RATE)
+#if (PDM_CAPTURE_RATE % ALGO_SAMPLE_RATE) || (PDM_DECIM_RATIO != 1 && PDM_DECIM_RATIO != 2 && PDM_DECIM_RATIO != 4 && PDM_DECIM_RATIO != 6)
+#error "PDM_CAPTURE_RATE只支持ALGO_SAMPLE_RATE的1/2/4/6倍"
+#endif
+#if PDM_DECIM_RATIO > 1
+#define PDM_RAW_SAMPLES (PDM_DECIM_RATIO * (ALGO_SAMPLE_RATE / 4))//0.25秒的原始数据，需为抽取倍数的整数倍
+static uint16_t pdm_raw_buf[PDM_RAW_SAMPLES];
+static int pdm_raw_read_pos = 0;//已抽取到的位置（原始采样）
+#define PDM_DMA_BUF pdm_raw_buf
+#else
+#define PDM_DMA_BUF pdm_buf
+#endif
+static volatile int total_bytes = 0;//PDM写位置（字节，PDM_DMA_BUF中）
+static int pdm_read_pos = 0;//算法任务已处理到的位置（采样）
 volatile uint8_t *current_pdm_write_buffer;
 volatile uint8_t *current_pdm_read_buffer;
-static bool buffer_full = false;
 OsalSemaphore *sem;
 
 static int speech_init_handle(EventManager mgr, EventId event_id, EventParam param){
@@ -75,15 +109,34 @@ static int speech_init_handle(EventManager mgr, EventId event_id, EventParam par
 }
 
 static int algo_handle(EventManager mgr, EventId event_id, EventParam param){
+	if (event_id == EVENT_AUD_PCM_DATA) {
+		// 上次处理位置到当前写位置之间的新采样交给流式MFCC提取，帧直接在pdm_buf上取，回绕由提取器处理
+#if PDM_DECIM_RATIO > 1
+		// 先把新的原始采样抽取到ALGO_SAMPLE_RATE写入pdm_buf，不足一个抽取倍数的余下采样留到下个周期
+		int raw_write_pos = total_bytes / sizeof(uint16_t);
+		int n_raw = (raw_write_pos - pdm_raw_read_pos + PDM_RAW_SAMPLES) % PDM_RAW_SAMPLES;
+		int n = capture_decimate((const int16_t*)pdm_raw_buf, PDM_RAW_SAMPLES, pdm_raw_read_pos, n_raw,
+		                         (int16_t*)pdm_buf, PDM_BUF_SAMPLES, pdm_read_pos);
+		pdm_raw_read_pos = (pdm_raw_read_pos + n * PDM_DECIM_RATIO) % PDM_RAW_SAMPLES;
+		int write_pos = (pdm_read_pos + n) % PDM_BUF_SAMPLES;
+#else
+		int write_pos = total_bytes / sizeof(uint16_t);
+		int n = (write_pos - pdm_read_pos + PDM_BUF_SAMPLES) % PDM_BUF_SAMPLES;
+#endif
+		// 先原位去直流（高通），pdm_buf中保存的都是滤波后的采样
+		capture_highpass((int16_t*)pdm_buf, PDM_BUF_SAMPLES, pdm_read_pos, n);
+		dataloader_stream((const int16_t*)pdm_buf, PDM_BUF_SAMPLES, n);
+		pdm_read_pos = write_pos;
+		return 0;
+	}
 	if (event_id == EVENT_AUD_PARAM) {
 		    // 确保 param 不是 NULL
 	        if (param == NULL) {
 	            printf("[Audio] Error: Received NULL parameter for battery event in custom handler!\n");
 	            return -1;
 	        }
-	        uint16_t* raw_data = (uint16_t*)param;
-	        //进行算法处理
-	        dataloader(raw_data);
+	        // 算法处理在EVENT_AUD_PCM_DATA中流式进行；pdm_buf只是数秒的环形缓冲区，
+	        // 不能交给按6秒分块的dataloader
 	        uint8_t *tmp = (uint8_t*)param; // 将void*参数转换为实际类型
 	        int zanshi = 0;
 		    //printf("[Battery] algo: %d%%\n", battery_level);
@@ -141,23 +194,10 @@ static void pdm_irq_handler(const PdmDevice *pdm, int size, void *cb_ctx)
 {
 	//PdmSubstream *s = (PdmSubstream *)cb_ctx;
 
-	// 切换缓冲区
-	// Switch buffers
-	total_bytes = (total_bytes + size);
-	//PdmSubstream *s = (PdmSubstream *)cb_ctx;
-	// 通知任务
-	if(total_bytes >= 96000){
-		total_bytes %= 96000;//设置回零
-		buffer_full  = true;//设置满标志
-		printf("PDM缓冲区满了\n");
-	}
-	if(buffer_full){
-		buffer_full = false;
-		osal_sem_wait(sem, 1000);
-		printf("pdm_irq_handler\n");
-		vpi_event_notify(EVENT_AUD_PARAM, pdm_buf);
-		osal_sem_post_isr(sem);
-	}
+	// 更新写位置，环形缓冲区写满后回到开头
+	total_bytes = (total_bytes + size) % sizeof(PDM_DMA_BUF);
+	// 每个周期通知算法任务处理新数据，特征提取分摊到各个周期
+	vpi_event_notify_from_isr(EVENT_AUD_PCM_DATA, (EventParam)pdm_buf);
 	//printf("pdm_irq_handler Finish\n");
 
 }
@@ -195,18 +235,24 @@ static void speech_task(void* param)//读取PDM数据
 	//int active_size = 0;
 
 	PdmSubstream stream = {
-	        .sample_rate = 8000,
+	        .sample_rate = PDM_CAPTURE_RATE,
 	        .sample_width = 16,
 	        .chan_num = 1,
 	        .xfer_mode = XFER_MODE_INTR,
-	        .buffer = { .base = (void*)pdm_buf, .size =  sizeof(pdm_buf),
+	        .buffer = { .base = (void*)PDM_DMA_BUF, .size =  sizeof(PDM_DMA_BUF),
 	        			.pos = 0, .available = 0},
 			.cb_context = &stream,
 			.cb = pdm_irq_handler//调用的时候stream.cb(argument)
 
 	    };
+	// 按实际采集采样率（抽取后）选择特征配置和抽取器，须在PDM开始产生数据之前完成
+	if (mfcc_select_rate(stream.sample_rate / PDM_DECIM_RATIO) < 0 ||
+	    capture_decimate_init(stream.sample_rate) < 0) {
+		uart_printf("Error: unsupported PDM sample rate %d!\r\n", (int)stream.sample_rate);
+		goto exit;
+	}
 	printf("开始讲话!\n");
-	stream.cb(PDMDevice, 8000, stream.cb_context);
+	// 写位置total_bytes即DMA位置，从0开始，不能再预先调用回调把它提前
 	 // 启动 PDM
 	//hal_pdm_start(PDMDevice, &stream);
 	hal_pdm_start(PDMDevice, &stream);
@@ -236,6 +282,7 @@ static void algo_task(void* param)//进行算法处理
 
 	algo_handle(Algo_Manager, id, param_algo_mgr);
 	vpi_event_register(id, Algo_Manager); // 将事件注册到新创建的管理器
+	vpi_event_register(EVENT_AUD_PCM_DATA, Algo_Manager); // PDM每周期的新数据
 	while (1) {
 		vpi_event_listen(Algo_Manager);
 		int ret = osal_sem_wait(sem, 1000);
@@ -267,7 +314,8 @@ int main(void)
     osal_pre_start_scheduler();
     osal_create_task(task_init_app, "init_app", 512, 7, NULL);
     osal_create_task(speech_task, "speech_task", 512, 5, NULL);
-    osal_create_task(algo_task, "algo_task", 512, 6, NULL);
+    // 算法任务每个周期做特征提取和GMM打分，FFT缓冲区已在静态区，栈上还有打分的分量数组和printf
+    osal_create_task(algo_task, "algo_task", 1024, 6, NULL);
     osal_start_scheduler();
 exit:
     goto exit;
@@ -0,0 +1,307 @@
+/*
+ * mfcc_kernel.h
+ *
+ *  MFCC前端内核模板，只由algo.c包含，每种采样率包含一次（故没有头文件保护）。
+ *  包含前定义：
+ *      MK(name)        生成本采样率的函数/变量名，如name##_8k
+ *      MK_TABLE(name)  mfcc_tables.h中本采样率的常量，如MFCC8K_##name
+ *  帧长、FFT点数、窗和滤波器表都是编译期常量，编译器对每种采样率各生成一份展开好的内核，
+ *  运行时只在mfcc_select_rate切换后端表，逐帧计算没有额外的分支和间接寻址。
+ */
+
+#define MK_FRAME_LEN      MK_TABLE(FRAME_LEN)
+#define MK_FFT_LEN        MK_TABLE(FFT_LEN)
+#define MK_FFT_LOG2_LEN   MK_TABLE(FFT_LOG2_LEN)
+
+#if (MK_FFT_LEN != 512) || (MK_FRAME_LEN > MK_FFT_LEN) || (MK_FFT_LEN > MFCC_MAX_FFT_LEN) || (MK_FRAME_LEN % 2)
+#error "riscv_mfcc_init_512_*只支持512点FFT，帧长须为偶数且不超过FFT点数"
+#endif
+
+#if !MFCC_FRONTEND_Q15
+// 实数FFT实例（NMSIS-DSP，只需初始化一次）
+static riscv_rfft_fast_instance_f32 MK(rfft_instance);
+static int MK(rfft_initialized);
+
+// 预加重+加窗融合：一次遍历int16输入，直接写FFT输入缓冲区的前MK_FRAME_LEN点
+static void MK(preemph_window_f32)(const int16_t* input, float* out) {
+    out[0] = (float)input[0] * MK_TABLE(WINDOW_F32)[0];
+    for (int i = 1; i < MK_FRAME_LEN; i++) {
+        out[i] = ((float)input[i] - PREEMPHASIS_ALPHA * input[i - 1]) * MK_TABLE(WINDOW_F32)[i];
+    }
+}
+
+// 主MFCC计算函数
+static void MK(compute_mfcc)(const int16_t* input_frame, float* mfcc_out) {
+    // 0. 初始化FFT实例（只需一次，窗、梅尔滤波器和DCT系数均为mfcc_tables.h中的常量表）
+    if (!MK(rfft_initialized)) {
+        riscv_rfft_fast_init_f32(&MK(rfft_instance), MK_FFT_LEN);
+        MK(rfft_initialized) = 1;
+    }
+
+    float* fft_in = mfcc_scratch.f32.in;
+    float* fft_out = mfcc_scratch.f32.out;
+    float* power_spectrum = mfcc_batch_power[0];    // 功率谱
+
+    // 1-3. 预加重、加窗并写入FFT输入（一次遍历），其余点补零
+    MK(preemph_window_f32)(input_frame, fft_in);
+    memset(&fft_in[MK_FRAME_LEN], 0, (MK_FFT_LEN - MK_FRAME_LEN) * sizeof(float));
+
+    // 4. 执行实数FFT，输出格式为[X0.re, X(N/2).re, X1.re, X1.im, ...]
+    riscv_rfft_fast_f32(&MK(rfft_instance), fft_in, fft_out, 0);
+
+    // 5. 计算功率谱（取前N/2+1点），直流与奈奎斯特点只有实部
+    power_spectrum[0] = fft_out[0] * fft_out[0];
+    power_spectrum[MK_FFT_LEN / 2] = fft_out[1] * fft_out[1];
+    riscv_cmplx_mag_squared_f32(&fft_out[2], &power_spectrum[1], MK_FFT_LEN / 2 - 1);
+
+    // 6-7. 应用稀疏梅尔滤波器组，只遍历每个三角形的非零bin（各三角形权重在表中依次排列）
+    float filter_energies[MEL_FILTERS];
+    const float* weights = MK_TABLE(FILTER_COEFS_F32);
+    for(int m = 0; m < MEL_FILTERS; m++){
+        const float* power = &power_spectrum[MK_TABLE(FILTER_POS)[m]];
+        float energy = 0.0f;
+        for (uint32_t j = 0; j < MK_TABLE(FILTER_LEN)[m]; j++) {
+            energy += power[j] * weights[j];
+        }
+        weights += MK_TABLE(FILTER_LEN)[m];
+        // 避免log(0)
+        if (energy < 1e-10) energy = 1e-10;
+        filter_energies[m] = energy;
+    }
+
+    // 8. 取对数
+    float log_energies[MEL_FILTERS];
+    for(int m = 0; m < MEL_FILTERS; m++){
+        log_energies[m] = logf(filter_energies[m]);
+    }
+
+    // 9. DCT变换获取MFCC系数：预生成的正交归一化DCT-II基矩阵乘对数能量向量
+    riscv_mat_vec_mult_f32(&dct_matrix_f32, log_energies, mfcc_out);
+}
+
+/*
+ * 批量MFCC：结果与compute_mfcc相同，但按阶段处理整批n帧（n <= MFCC_BATCH_MAX）。
+ * 先逐帧做预加重加窗、FFT和功率谱（旋转因子和位反转表在这批帧之间保持在缓存中），
+ * 再以滤波器为外层、帧为内层做梅尔滤波（每个三角形的权重只加载一次），最后一次矩阵乘完成整批DCT。
+ */
+static void MK(compute_mfcc_batch)(const int16_t* const* frames, int n, float* mfcc_out) {
+    if (!MK(rfft_initialized)) {
+        riscv_rfft_fast_init_f32(&MK(rfft_instance), MK_FFT_LEN);
+        MK(rfft_initialized) = 1;
+    }
+
+    float* fft_in = mfcc_scratch.f32.in;
+    float* fft_out = mfcc_scratch.f32.out;
+
+    // 1-5. 预加重加窗、实数FFT、功率谱
+    for (int f = 0; f < n; f++) {
+        float* power_spectrum = mfcc_batch_power[f];
+        MK(preemph_window_f32)(frames[f], fft_in);
+        memset(&fft_in[MK_FRAME_LEN], 0, (MK_FFT_LEN - MK_FRAME_LEN) * sizeof(float));
+        riscv_rfft_fast_f32(&MK(rfft_instance), fft_in, fft_out, 0);
+        power_spectrum[0] = fft_out[0] * fft_out[0];
+        power_spectrum[MK_FFT_LEN / 2] = fft_out[1] * fft_out[1];
+        riscv_cmplx_mag_squared_f32(&fft_out[2], &power_spectrum[1], MK_FFT_LEN / 2 - 1);
+    }
+
+    // 6-8. 稀疏梅尔滤波并取对数
+    const float* weights = MK_TABLE(FILTER_COEFS_F32);
+    for (int m = 0; m < MEL_FILTERS; m++) {
+        uint32_t pos = MK_TABLE(FILTER_POS)[m];
+        uint32_t len = MK_TABLE(FILTER_LEN)[m];
+        for (int f = 0; f < n; f++) {
+            const float* power = &mfcc_batch_power[f][pos];
+            float energy = 0.0f;
+            for (uint32_t j = 0; j < len; j++) {
+                energy += power[j] * weights[j];
+            }
+            if (energy < 1e-10) energy = 1e-10;
+            mfcc_batch_log[f][m] = logf(energy);
+        }
+        weights += len;
+    }
+
+    // 9. 整批DCT
+    mfcc_dct_batch(&mfcc_batch_log[0][0], n, mfcc_out);
+}
+
+#else
+static riscv_rfft_instance_q15 MK(rfft_instance_q15);
+
+/*
+ * 预加重+加窗融合核（Q15）：一次遍历int16输入，左移shift位归一化后计算
+ * (x[i] - 0.97*x[i-1]) / 2 再乘窗，直接写入FFT输入缓冲区的前MK_FRAME_LEN点。
+ * P扩展下每次处理两个采样：KHM16做两路Q15乘法，PKBT16拼出{x[i], x[i-1]}这一对延迟采样。
+ * 标量版本按同样的舍入计算，两种实现结果逐位一致。
+ */
+static void MK(preemph_window_q15)(const int16_t* input, int shift, q15_t* out) {
+#if defined(RISCV_MATH_DSP)
+    const uint32_t alpha_x2 = ((uint32_t)PREEMPHASIS_ALPHA_HALF_Q15 << 16) | PREEMPHASIS_ALPHA_HALF_Q15;
+    uint32_t prev = 0;                  // 上一对采样，高16位为x[i-1]
+    for (int i = 0; i < MK_FRAME_LEN; i += 2) {
+        uint32_t cur = __RV_KSLL16((uint32_t)read_q15x2(&input[i]), shift);
+        uint32_t delayed = __RV_PKBT16(cur, prev);
+        uint32_t preemph = __RV_KSUB16(__RV_SRA16(cur, 1), __RV_KHM16(delayed, alpha_x2));
+        write_q15x2(&out[i], (q31_t)__RV_KHM16(preemph, (uint32_t)read_q15x2(&MK_TABLE(WINDOW_Q15)[i])));
+        prev = cur;
+    }
+#else
+    int32_t prev = 0;
+    for (int i = 0; i < MK_FRAME_LEN; i++) {
+        int32_t cur = (int32_t)input[i] << shift;
+        int32_t preemph = (cur >> 1) - ((prev * PREEMPHASIS_ALPHA_HALF_Q15) >> 15);
+        out[i] = (q15_t)((preemph * MK_TABLE(WINDOW_Q15)[i]) >> 15);
+        prev = cur;
+    }
+#endif
+}
+
+// 定点MFCC计算函数，mfcc_out为Q8.7格式
+static void MK(compute_mfcc_q15)(const int16_t* input_frame, q15_t* mfcc_out) {
+    // 0. 初始化定点FFT实例（只需一次，其余系数均为mfcc_tables.h中的常量表）
+    static int tables_initialized = 0;
+    if (!tables_initialized) {
+        riscv_rfft_init_q15(&MK(rfft_instance_q15), MK_FFT_LEN, 0, 1);
+        tables_initialized = 1;
+    }
+
+    q15_t* fft_in = mfcc_scratch.q15.in;    // FFT输入（补零到FFT点数）
+    q15_t* fft_out = mfcc_scratch.q15.spectrum.fft_out;
+    uint32_t* power_spectrum = mfcc_scratch.q15.spectrum.power;
+
+    // 1. 输入块浮点归一化：小信号先左移到接近满量程，避免预加重的截断误差淹没弱频带
+    q15_t peak;
+    int shift = 0;
+    riscv_absmax_no_idx_q15(input_frame, MK_FRAME_LEN, &peak);
+    if (peak > 0) {
+        shift = __builtin_clz((uint32_t)peak) - 17;
+    }
+
+    // 2. 预加重（右移1位防止溢出）并加窗
+    MK(preemph_window_q15)(input_frame, shift, fft_in);
+    memset(&fft_in[MK_FRAME_LEN], 0, (MK_FFT_LEN - MK_FRAME_LEN) * sizeof(q15_t));
+
+    // 3. 加窗后再次归一化，减小FFT逐级缩放带来的精度损失
+    int window_shift = 0;
+    riscv_absmax_no_idx_q15(fft_in, MK_FRAME_LEN, &peak);
+    if (peak > 0) {
+        window_shift = __builtin_clz((uint32_t)peak) - 17;
+    }
+    riscv_shift_q15(fft_in, window_shift, fft_in, MK_FRAME_LEN);
+    shift += window_shift;
+
+    // 4. 定点实数FFT（内部每级缩小1位，共缩小2^MK_FFT_LOG2_LEN）
+    riscv_rfft_q15(&MK(rfft_instance_q15), fft_in, fft_out);
+
+    // 5. 计算功率谱（取前N/2+1点，Q30）
+    // riscv_cmplx_mag_squared_q15的3.13输出会丢掉低17位，比峰值低约50dB的频点全部变成0，
+    // 这里保留完整的32位平方和，每个功率值正好覆盖它自己的(re, im)位置
+    for (int k = 0; k <= MK_FFT_LEN / 2; k++) {
+#if defined(RISCV_MATH_DSP)
+        q31_t bin = read_q15x2(&fft_out[2 * k]);
+        power_spectrum[k] = (uint32_t)__RV_KMDA(bin, bin);
+#else
+        int32_t re = fft_out[2 * k];
+        int32_t im = fft_out[2 * k + 1];
+        power_spectrum[k] = (uint32_t)(re * re) + (uint32_t)(im * im);
+#endif
+    }
+
+    // 6-8. Q31功率与Q15权重做64位梅尔累加，再查表取对数
+    // 累加值acc与浮点前端能量E的关系：E = acc * 2^(2 * MK_FFT_LOG2_LEN - 13 - 2 * shift)
+    int32_t scale_log2_q16 = (2 * MK_FFT_LOG2_LEN - 13 - 2 * shift) * 65536;
+    q15_t log_energies[MEL_FILTERS];
+    const q15_t* weights = MK_TABLE(FILTER_COEFS_Q15);
+    for (int m = 0; m < MEL_FILTERS; m++) {
+        const uint32_t* power = &power_spectrum[MK_TABLE(FILTER_POS)[m]];
+        uint64_t energy = 0;
+        for (uint32_t j = 0; j < MK_TABLE(FILTER_LEN)[m]; j++) {
+            energy += (uint64_t)power[j] * (uint16_t)weights[j];
+        }
+        weights += MK_TABLE(FILTER_LEN)[m];
+        int32_t log2_energy = log2_q16(energy) + scale_log2_q16;
+        // ln(E) = log2(E) * ln(2)，Q16 * Q16 -> Q8.7
+        int32_t ln_energy = (int32_t)(((int64_t)log2_energy * LN2_Q16) >> (32 - LOG_ENERGY_FRAC));
+        log_energies[m] = (q15_t)__SSAT(ln_energy, 16);
+    }
+
+    // 9. DCT变换获取MFCC系数：Q15基矩阵乘Q8.7对数能量向量
+    riscv_mat_vec_mult_q15(&dct_matrix_q15, log_energies, mfcc_out);
+}
+#endif /* MFCC_FRONTEND_Q15 */
+
+// 自带前端作为后端（浮点或Q15由MFCC_FRONTEND_Q15决定）
+static void MK(native_mfcc_compute)(const int16_t* frame, float* mfcc_out) {
+#if MFCC_FRONTEND_Q15
+    q15_t mfcc_q15[N_MFCC];
+    MK(compute_mfcc_q15)(frame, mfcc_q15);
+    for (int i = 0; i < N_MFCC; i++) {
+        mfcc_out[i] = (float)mfcc_q15[i] / (1 << MFCC_Q15_FRAC);
+    }
+#else
+    MK(compute_mfcc)(frame, mfcc_out);
+#endif
+}
+
+// NMSIS-DSP后端（说明见algo.c），输入输出缓冲区各采样率共用
+static riscv_mfcc_instance_f32 MK(nmsis_mfcc_f32);
+static riscv_mfcc_instance_q15 MK(nmsis_mfcc_q15);
+
+static void MK(nmsis_f32_init)(void) {
+    riscv_mfcc_init_512_f32(&MK(nmsis_mfcc_f32), MEL_FILTERS, N_MFCC, MFCC_DCT_COEFS_F32,
+                            MK_TABLE(FILTER_POS), MK_TABLE(FILTER_LEN), MK_TABLE(FILTER_COEFS_F32),
+                            MK_TABLE(WINDOW_F32));
+}
+
+static void MK(nmsis_f32_compute)(const int16_t* frame, float* mfcc_out) {
+    // 预加重后补零到FFT点数，汉明窗由库内部的windowCoefs完成
+    nmsis_frame_f32[0] = (float)frame[0];
+    for (int i = 1; i < MK_FRAME_LEN; i++) {
+        nmsis_frame_f32[i] = (float)frame[i] - PREEMPHASIS_ALPHA * frame[i - 1];
+    }
+    memset(&nmsis_frame_f32[MK_FRAME_LEN], 0, (MK_FFT_LEN - MK_FRAME_LEN) * sizeof(float));
+
+    riscv_mfcc_f32(&MK(nmsis_mfcc_f32), nmsis_frame_f32, mfcc_out, nmsis_tmp_f32);
+    riscv_scale_f32(mfcc_out, 2.0f, mfcc_out, N_MFCC);
+}
+
+static void MK(nmsis_q15_init)(void) {
+    riscv_mfcc_init_512_q15(&MK(nmsis_mfcc_q15), MEL_FILTERS, N_MFCC, MFCC_DCT_COEFS_Q15,
+                            MK_TABLE(FILTER_POS), MK_TABLE(FILTER_LEN), MK_TABLE(FILTER_COEFS_Q15),
+                            MK_TABLE(WINDOW_Q15));
+}
+
+static void MK(nmsis_q15_compute)(const int16_t* frame, float* mfcc_out) {
+    // 预加重结果右移1位防止溢出，库内部会按帧峰值重新归一化
+    q15_t mfcc_q15[N_MFCC];
+    nmsis_frame_q15[0] = frame[0] >> 1;
+    for (int i = 1; i < MK_FRAME_LEN; i++) {
+        int32_t preemph = ((int32_t)frame[i] << 15) - PREEMPHASIS_ALPHA_Q15 * (int32_t)frame[i - 1];
+        nmsis_frame_q15[i] = (q15_t)(preemph >> 16);
+    }
+    memset(&nmsis_frame_q15[MK_FRAME_LEN], 0, (MK_FFT_LEN - MK_FRAME_LEN) * sizeof(q15_t));
+
+    riscv_mfcc_q15(&MK(nmsis_mfcc_q15), nmsis_frame_q15, mfcc_q15, nmsis_tmp_q15);
+    // 输出为Q8.7
+    for (int i = 0; i < N_MFCC; i++) {
+        mfcc_out[i] = 2.0f * mfcc_q15[i] / 128.0f;
+    }
+}
+
+// 批量接口只有浮点自带前端实现，其余后端由mfcc_process_batch逐帧调用；
+// Q15前端（MFCC_FRONTEND_Q15）没有批量实现，逐帧处理，不做按阶段的分批
+static const MfccBackend MK(mfcc_backends)[MFCC_BACKEND_NUM] = {
+#if MFCC_FRONTEND_Q15
+    [MFCC_BACKEND_NATIVE]    = { "native",    NULL,               MK(native_mfcc_compute), NULL },
+#else
+    [MFCC_BACKEND_NATIVE]    = { "native",    NULL,               MK(native_mfcc_compute), MK(compute_mfcc_batch) },
+#endif
+    [MFCC_BACKEND_NMSIS_F32] = { "nmsis_f32", MK(nmsis_f32_init), MK(nmsis_f32_compute),   NULL },
+    [MFCC_BACKEND_NMSIS_Q15] = { "nmsis_q15", MK(nmsis_q15_init), MK(nmsis_q15_compute),   NULL },
+};
+
+#undef MK_FRAME_LEN
+#undef MK_FFT_LEN
+#undef MK_FFT_LOG2_LEN
+#undef MK
+#undef MK_TABLE
@@ -0,0 +1,1207 @@
+/*
+ * mfcc_tables.h
+ *
+ *  由python代码/gen_mfcc_tables.py自动生成，请勿手工修改
+ */
+
+#ifndef GALAXY_SDK_MFCC_TABLES_H_
+#define GALAXY_SDK_MFCC_TABLES_H_
+
+#include "riscv_math.h"
+
+#define MFCC_TABLE_MEL_FILTERS 40
+#define MFCC_TABLE_N_MFCC 13
+#define MFCC_TABLE_LOG2_LUT_BITS 6
+#define MFCC_TABLE_HPF_CUTOFF_HZ 60
+#define MFCC_TABLE_DECIM_TAPS_PER_RATIO 24
+
+static const q15_t MFCC_DECIM2_TAPS_Q15[48] = {
+    -6, -12, 20, 30, -43, -59, 80, 105,
+    -136, -173, 218, 271, -335, -411, 503, 614,
+    -753, -930, 1164, 1491, -1991, -2866, 4867, 14737,
+    14737, 4867, -2866, -1991, 1491, 1164, -930, -753,
+    614, 503, -411, -335, 271, 218, -173, -136,
+    105, 80, -59, -43, 30, 20, -12, -6,
+};
+
+static const q15_t MFCC_DECIM4_TAPS_Q15[96] = {
+    -2, -6, -8, -4, 5, 16, 19, 9,
+    -11, -32, -38, -18, 21, 58, 67, 32,
+    -36, -97, -110, -51, 57, 154, 171, 79,
+    -87, -234, -258, -118, 131, 348, 385, 176,
+    -195, -521, -578, -267, 298, 809, 915, 432,
+    -499, -1413, -1693, -867, 1125, 3828, 6410, 7983,
+    7983, 6410, 3828, 1125, -867, -1693, -1413, -499,
+    432, 915, 809, 298, -267, -578, -521, -195,
+    176, 385, 348, 131, -118, -258, -234, -87,
+    79, 171, 154, 57, -51, -110, -97, -36,
+    32, 67, 58, 21, -18, -38, -32, -11,
+    9, 19, 16, 5, -4, -8, -6, -2,
+};
+
+static const q15_t MFCC_DECIM6_TAPS_Q15[144] = {
+    -1, -3, -4, -5, -5, -2, 2, 7,
+    12, 13, 11, 4, -5, -15, -23, -26,
+    -21, -9, 9, 28, 42, 46, 37, 15,
+    -16, -47, -70, -76, -60, -24, 25, 75,
+    110, 118, 93, 36, -39, -114, -166, -178,
+    -139, -54, 58, 170, 248, 264, 207, 81,
+    -87, -253, -370, -397, -312, -123, 132, 389,
+    576, 625, 498, 200, -220, -665, -1014, -1143,
+    -956, -407, 484, 1623, 2862, 4018, 4913, 5400,
+    5400, 4913, 4018, 2862, 1623, 484, -407, -956,
+    -1143, -1014, -665, -220, 200, 498, 625, 576,
+    389, 132, -123, -312, -397, -370, -253, -87,
+    81, 207, 264, 248, 170, 58, -54, -139,
+    -178, -166, -114, -39, 36, 93, 118, 110,
+    75, 25, -24, -60, -76, -70, -47, -16,
+    15, 37, 46, 42, 28, 9, -9, -21,
+    -26, -23, -15, -5, 4, 11, 13, 12,
+    7, 2, -2, -5, -5, -4, -3, -1,
+};
+
+static const float32_t MFCC_DCT_COEFS_F32[520] = {
+    1.581138819e-01f, 1.581138819e-01f, 1.581138819e-01f, 1.581138819e-01f,
+    1.581138819e-01f, 1.581138819e-01f, 1.581138819e-01f, 1.581138819e-01f,
+    1.581138819e-01f, 1.581138819e-01f, 1.581138819e-01f, 1.581138819e-01f,
+    1.581138819e-01f, 1.581138819e-01f, 1.581138819e-01f, 1.581138819e-01f,
+    1.581138819e-01f, 1.581138819e-01f, 1.581138819e-01f, 1.581138819e-01f,
+    1.581138819e-01f, 1.581138819e-01f, 1.581138819e-01f, 1.581138819e-01f,
+    1.581138819e-01f, 1.581138819e-01f, 1.581138819e-01f, 1.581138819e-01f,
+    1.581138819e-01f, 1.581138819e-01f, 1.581138819e-01f, 1.581138819e-01f,
+    1.581138819e-01f, 1.581138819e-01f, 1.581138819e-01f, 1.581138819e-01f,
+    1.581138819e-01f, 1.581138819e-01f, 1.581138819e-01f, 1.581138819e-01f,
+    2.234344035e-01f, 2.220568508e-01f, 2.193102539e-01f, 2.152115405e-01f,
+    2.097859532e-01f, 2.030669898e-01f, 1.950960308e-01f, 1.859222502e-01f,
+    1.756021976e-01f, 1.641995013e-01f, 1.517844647e-01f, 1.384336203e-01f,
+    1.242292821e-01f, 1.092590317e-01f, 9.361516684e-02f, 7.739412785e-02f,
+    6.069593132e-02f, 4.362352192e-02f, 2.628216147e-02f, 8.778762072e-03f,
+    -8.778762072e-03f, -2.628216147e-02f, -4.362352192e-02f, -6.069593132e-02f,
+    -7.739412785e-02f, -9.361516684e-02f, -1.092590317e-01f, -1.242292821e-01f,
+    -1.384336203e-01f, -1.517844647e-01f, -1.641995013e-01f, -1.756021976e-01f,
+    -1.859222502e-01f, -1.950960308e-01f, -2.030669898e-01f, -2.097859532e-01f,
+    -2.152115405e-01f, -2.193102539e-01f, -2.220568508e-01f, -2.234344035e-01f,
+    2.229174972e-01f, 2.174285203e-01f, 2.065857500e-01f, 1.906561404e-01f,
+    1.700319499e-01f, 1.452209949e-01f, 1.168342307e-01f, 8.557061851e-02f,
+    5.219997093e-02f, 1.754398644e-02f, -1.754398644e-02f, -5.219997093e-02f,
+    -8.557061851e-02f, -1.168342307e-01f, -1.452209949e-01f, -1.700319499e-01f,
+    -1.906561404e-01f, -2.065857500e-01f, -2.174285203e-01f, -2.229174972e-01f,
+    -2.229174972e-01f, -2.174285203e-01f, -2.065857500e-01f, -1.906561404e-01f,
+    -1.700319499e-01f, -1.452209949e-01f, -1.168342307e-01f, -8.557061851e-02f,
+    -5.219997093e-02f, -1.754398644e-02f, 1.754398644e-02f, 5.219997093e-02f,
+    8.557061851e-02f, 1.168342307e-01f, 1.452209949e-01f, 1.700319499e-01f,
+    1.906561404e-01f, 2.065857500e-01f, 2.174285203e-01f, 2.229174972e-01f,
+    2.220568508e-01f, 2.097859532e-01f, 1.859222502e-01f, 1.517844647e-01f,
+    1.092590317e-01f, 6.069593132e-02f, 8.778762072e-03f, -4.362352192e-02f,
+    -9.361516684e-02f, -1.384336203e-01f, -1.756021976e-01f, -2.030669898e-01f,
+    -2.193102539e-01f, -2.234344035e-01f, -2.152115405e-01f, -1.950960308e-01f,
+    -1.641995013e-01f, -1.242292821e-01f, -7.739412785e-02f, -2.628216147e-02f,
+    2.628216147e-02f, 7.739412785e-02f, 1.242292821e-01f, 1.641995013e-01f,
+    1.950960308e-01f, 2.152115405e-01f, 2.234344035e-01f, 2.193102539e-01f,
+    2.030669898e-01f, 1.756021976e-01f, 1.384336203e-01f, 9.361516684e-02f,
+    4.362352192e-02f, -8.778762072e-03f, -6.069593132e-02f, -1.092590317e-01f,
+    -1.517844647e-01f, -1.859222502e-01f, -2.097859532e-01f, -2.220568508e-01f,
+    2.208538204e-01f, 1.992351115e-01f, 1.581138819e-01f, 1.015153602e-01f,
+    3.497980908e-02f, -3.497980908e-02f, -1.015153602e-01f, -1.581138819e-01f,
+    -1.992351115e-01f, -2.208538204e-01f, -2.208538204e-01f, -1.992351115e-01f,
+    -1.581138819e-01f, -1.015153602e-01f, -3.497980908e-02f, 3.497980908e-02f,
+    1.015153602e-01f, 1.581138819e-01f, 1.992351115e-01f, 2.208538204e-01f,
+    2.208538204e-01f, 1.992351115e-01f, 1.581138819e-01f, 1.015153602e-01f,
+    3.497980908e-02f, -3.497980908e-02f, -1.015153602e-01f, -1.581138819e-01f,
+    -1.992351115e-01f, -2.208538204e-01f, -2.208538204e-01f, -1.992351115e-01f,
+    -1.581138819e-01f, -1.015153602e-01f, -3.497980908e-02f, 3.497980908e-02f,
+    1.015153602e-01f, 1.581138819e-01f, 1.992351115e-01f, 2.208538204e-01f,
+    2.193102539e-01f, 1.859222502e-01f, 1.242292821e-01f, 4.362352192e-02f,
+    -4.362352192e-02f, -1.242292821e-01f, -1.859222502e-01f, -2.193102539e-01f,
+    -2.193102539e-01f, -1.859222502e-01f, -1.242292821e-01f, -4.362352192e-02f,
+    4.362352192e-02f, 1.242292821e-01f, 1.859222502e-01f, 2.193102539e-01f,
+    2.193102539e-01f, 1.859222502e-01f, 1.242292821e-01f, 4.362352192e-02f,
+    -4.362352192e-02f, -1.242292821e-01f, -1.859222502e-01f, -2.193102539e-01f,
+    -2.193102539e-01f, -1.859222502e-01f, -1.242292821e-01f, -4.362352192e-02f,
+    4.362352192e-02f, 1.242292821e-01f, 1.859222502e-01f, 2.193102539e-01f,
+    2.193102539e-01f, 1.859222502e-01f, 1.242292821e-01f, 4.362352192e-02f,
+    -4.362352192e-02f, -1.242292821e-01f, -1.859222502e-01f, -2.193102539e-01f,
+    2.174285203e-01f, 1.700319499e-01f, 8.557061851e-02f, -1.754398644e-02f,
+    -1.168342307e-01f, -1.906561404e-01f, -2.229174972e-01f, -2.065857500e-01f,
+    -1.452209949e-01f, -5.219997093e-02f, 5.219997093e-02f, 1.452209949e-01f,
+    2.065857500e-01f, 2.229174972e-01f, 1.906561404e-01f, 1.168342307e-01f,
+    1.754398644e-02f, -8.557061851e-02f, -1.700319499e-01f, -2.174285203e-01f,
+    -2.174285203e-01f, -1.700319499e-01f, -8.557061851e-02f, 1.754398644e-02f,
+    1.168342307e-01f, 1.906561404e-01f, 2.229174972e-01f, 2.065857500e-01f,
+    1.452209949e-01f, 5.219997093e-02f, -5.219997093e-02f, -1.452209949e-01f,
+    -2.065857500e-01f, -2.229174972e-01f, -1.906561404e-01f, -1.168342307e-01f,
+    -1.754398644e-02f, 8.557061851e-02f, 1.700319499e-01f, 2.174285203e-01f,
+    2.152115405e-01f, 1.517844647e-01f, 4.362352192e-02f, -7.739412785e-02f,
+    -1.756021976e-01f, -2.220568508e-01f, -2.030669898e-01f, -1.242292821e-01f,
+    -8.778762072e-03f, 1.092590317e-01f, 1.950960308e-01f, 2.234344035e-01f,
+    1.859222502e-01f, 9.361516684e-02f, -2.628216147e-02f, -1.384336203e-01f,
+    -2.097859532e-01f, -2.193102539e-01f, -1.641995013e-01f, -6.069593132e-02f,
+    6.069593132e-02f, 1.641995013e-01f, 2.193102539e-01f, 2.097859532e-01f,
+    1.384336203e-01f, 2.628216147e-02f, -9.361516684e-02f, -1.859222502e-01f,
+    -2.234344035e-01f, -1.950960308e-01f, -1.092590317e-01f, 8.778762072e-03f,
+    1.242292821e-01f, 2.030669898e-01f, 2.220568508e-01f, 1.756021976e-01f,
+    7.739412785e-02f, -4.362352192e-02f, -1.517844647e-01f, -2.152115405e-01f,
+    2.126626968e-01f, 1.314327717e-01f, 1.369196747e-17f, -1.314327717e-01f,
+    -2.126626968e-01f, -2.126626968e-01f, -1.314327717e-01f, -4.107590325e-17f,
+    1.314327717e-01f, 2.126626968e-01f, 2.126626968e-01f, 1.314327717e-01f,
+    6.845983654e-17f, -1.314327717e-01f, -2.126626968e-01f, -2.126626968e-01f,
+    -1.314327717e-01f, -9.584376983e-17f, 1.314327717e-01f, 2.126626968e-01f,
+    2.126626968e-01f, 1.314327717e-01f, 1.232277031e-16f, -1.314327717e-01f,
+    -2.126626968e-01f, -2.126626968e-01f, -1.314327717e-01f, 2.465938167e-16f,
+    1.314327717e-01f, 2.126626968e-01f, 2.126626968e-01f, 1.314327717e-01f,
+    5.752010162e-16f, -1.314327717e-01f, -2.126626968e-01f, -2.126626968e-01f,
+    -1.314327717e-01f, -6.025849561e-16f, 1.314327717e-01f, 2.126626968e-01f,
+    2.097859532e-01f, 1.092590317e-01f, -4.362352192e-02f, -1.756021976e-01f,
+    -2.234344035e-01f, -1.641995013e-01f, -2.628216147e-02f, 1.242292821e-01f,
+    2.152115405e-01f, 2.030669898e-01f, 9.361516684e-02f, -6.069593132e-02f,
+    -1.859222502e-01f, -2.220568508e-01f, -1.517844647e-01f, -8.778762072e-03f,
+    1.384336203e-01f, 2.193102539e-01f, 1.950960308e-01f, 7.739412785e-02f,
+    -7.739412785e-02f, -1.950960308e-01f, -2.193102539e-01f, -1.384336203e-01f,
+    8.778762072e-03f, 1.517844647e-01f, 2.220568508e-01f, 1.859222502e-01f,
+    6.069593132e-02f, -9.361516684e-02f, -2.030669898e-01f, -2.152115405e-01f,
+    -1.242292821e-01f, 2.628216147e-02f, 1.641995013e-01f, 2.234344035e-01f,
+    1.756021976e-01f, 4.362352192e-02f, -1.092590317e-01f, -2.097859532e-01f,
+    2.065857500e-01f, 8.557061851e-02f, -8.557061851e-02f, -2.065857500e-01f,
+    -2.065857500e-01f, -8.557061851e-02f, 8.557061851e-02f, 2.065857500e-01f,
+    2.065857500e-01f, 8.557061851e-02f, -8.557061851e-02f, -2.065857500e-01f,
+    -2.065857500e-01f, -8.557061851e-02f, 8.557061851e-02f, 2.065857500e-01f,
+    2.065857500e-01f, 8.557061851e-02f, -8.557061851e-02f, -2.065857500e-01f,
+    -2.065857500e-01f, -8.557061851e-02f, 8.557061851e-02f, 2.065857500e-01f,
+    2.065857500e-01f, 8.557061851e-02f, -8.557061851e-02f, -2.065857500e-01f,
+    -2.065857500e-01f, -8.557061851e-02f, 8.557061851e-02f, 2.065857500e-01f,
+    2.065857500e-01f, 8.557061851e-02f, -8.557061851e-02f, -2.065857500e-01f,
+    -2.065857500e-01f, -8.557061851e-02f, 8.557061851e-02f, 2.065857500e-01f,
+    2.030669898e-01f, 6.069593132e-02f, -1.242292821e-01f, -2.220568508e-01f,
+    -1.641995013e-01f, 8.778762072e-03f, 1.756021976e-01f, 2.193102539e-01f,
+    1.092590317e-01f, -7.739412785e-02f, -2.097859532e-01f, -1.950960308e-01f,
+    -4.362352192e-02f, 1.384336203e-01f, 2.234344035e-01f, 1.517844647e-01f,
+    -2.628216147e-02f, -1.859222502e-01f, -2.152115405e-01f, -9.361516684e-02f,
+    9.361516684e-02f, 2.152115405e-01f, 1.859222502e-01f, 2.628216147e-02f,
+    -1.517844647e-01f, -2.234344035e-01f, -1.384336203e-01f, 4.362352192e-02f,
+    1.950960308e-01f, 2.097859532e-01f, 7.739412785e-02f, -1.092590317e-01f,
+    -2.193102539e-01f, -1.756021976e-01f, -8.778762072e-03f, 1.641995013e-01f,
+    2.220568508e-01f, 1.242292821e-01f, -6.069593132e-02f, -2.030669898e-01f,
+    1.992351115e-01f, 3.497980908e-02f, -1.581138819e-01f, -2.208538204e-01f,
+    -1.015153602e-01f, 1.015153602e-01f, 2.208538204e-01f, 1.581138819e-01f,
+    -3.497980908e-02f, -1.992351115e-01f, -1.992351115e-01f, -3.497980908e-02f,
+    1.581138819e-01f, 2.208538204e-01f, 1.015153602e-01f, -1.015153602e-01f,
+    -2.208538204e-01f, -1.581138819e-01f, 3.497980908e-02f, 1.992351115e-01f,
+    1.992351115e-01f, 3.497980908e-02f, -1.581138819e-01f, -2.208538204e-01f,
+    -1.015153602e-01f, 1.015153602e-01f, 2.208538204e-01f, 1.581138819e-01f,
+    -3.497980908e-02f, -1.992351115e-01f, -1.992351115e-01f, -3.497980908e-02f,
+    1.581138819e-01f, 2.208538204e-01f, 1.015153602e-01f, -1.015153602e-01f,
+    -2.208538204e-01f, -1.581138819e-01f, 3.497980908e-02f, 1.992351115e-01f,
+};
+
+static const float32_t MFCC_DCT_COEFS_T_F32[520] = {
+    1.581138819e-01f, 2.234344035e-01f, 2.229174972e-01f, 2.220568508e-01f,
+    2.208538204e-01f, 2.193102539e-01f, 2.174285203e-01f, 2.152115405e-01f,
+    2.126626968e-01f, 2.097859532e-01f, 2.065857500e-01f, 2.030669898e-01f,
+    1.992351115e-01f, 1.581138819e-01f, 2.220568508e-01f, 2.174285203e-01f,
+    2.097859532e-01f, 1.992351115e-01f, 1.859222502e-01f, 1.700319499e-01f,
+    1.517844647e-01f, 1.314327717e-01f, 1.092590317e-01f, 8.557061851e-02f,
+    6.069593132e-02f, 3.497980908e-02f, 1.581138819e-01f, 2.193102539e-01f,
+    2.065857500e-01f, 1.859222502e-01f, 1.581138819e-01f, 1.242292821e-01f,
+    8.557061851e-02f, 4.362352192e-02f, 1.369196747e-17f, -4.362352192e-02f,
+    -8.557061851e-02f, -1.242292821e-01f, -1.581138819e-01f, 1.581138819e-01f,
+    2.152115405e-01f, 1.906561404e-01f, 1.517844647e-01f, 1.015153602e-01f,
+    4.362352192e-02f, -1.754398644e-02f, -7.739412785e-02f, -1.314327717e-01f,
+    -1.756021976e-01f, -2.065857500e-01f, -2.220568508e-01f, -2.208538204e-01f,
+    1.581138819e-01f, 2.097859532e-01f, 1.700319499e-01f, 1.092590317e-01f,
+    3.497980908e-02f, -4.362352192e-02f, -1.168342307e-01f, -1.756021976e-01f,
+    -2.126626968e-01f, -2.234344035e-01f, -2.065857500e-01f, -1.641995013e-01f,
+    -1.015153602e-01f, 1.581138819e-01f, 2.030669898e-01f, 1.452209949e-01f,
+    6.069593132e-02f, -3.497980908e-02f, -1.242292821e-01f, -1.906561404e-01f,
+    -2.220568508e-01f, -2.126626968e-01f, -1.641995013e-01f, -8.557061851e-02f,
+    8.778762072e-03f, 1.015153602e-01f, 1.581138819e-01f, 1.950960308e-01f,
+    1.168342307e-01f, 8.778762072e-03f, -1.015153602e-01f, -1.859222502e-01f,
+    -2.229174972e-01f, -2.030669898e-01f, -1.314327717e-01f, -2.628216147e-02f,
+    8.557061851e-02f, 1.756021976e-01f, 2.208538204e-01f, 1.581138819e-01f,
+    1.859222502e-01f, 8.557061851e-02f, -4.362352192e-02f, -1.581138819e-01f,
+    -2.193102539e-01f, -2.065857500e-01f, -1.242292821e-01f, -4.107590325e-17f,
+    1.242292821e-01f, 2.065857500e-01f, 2.193102539e-01f, 1.581138819e-01f,
+    1.581138819e-01f, 1.756021976e-01f, 5.219997093e-02f, -9.361516684e-02f,
+    -1.992351115e-01f, -2.193102539e-01f, -1.452209949e-01f, -8.778762072e-03f,
+    1.314327717e-01f, 2.152115405e-01f, 2.065857500e-01f, 1.092590317e-01f,
+    -3.497980908e-02f, 1.581138819e-01f, 1.641995013e-01f, 1.754398644e-02f,
+    -1.384336203e-01f, -2.208538204e-01f, -1.859222502e-01f, -5.219997093e-02f,
+    1.092590317e-01f, 2.126626968e-01f, 2.030669898e-01f, 8.557061851e-02f,
+    -7.739412785e-02f, -1.992351115e-01f, 1.581138819e-01f, 1.517844647e-01f,
+    -1.754398644e-02f, -1.756021976e-01f, -2.208538204e-01f, -1.242292821e-01f,
+    5.219997093e-02f, 1.950960308e-01f, 2.126626968e-01f, 9.361516684e-02f,
+    -8.557061851e-02f, -2.097859532e-01f, -1.992351115e-01f, 1.581138819e-01f,
+    1.384336203e-01f, -5.219997093e-02f, -2.030669898e-01f, -1.992351115e-01f,
+    -4.362352192e-02f, 1.452209949e-01f, 2.234344035e-01f, 1.314327717e-01f,
+    -6.069593132e-02f, -2.065857500e-01f, -1.950960308e-01f, -3.497980908e-02f,
+    1.581138819e-01f, 1.242292821e-01f, -8.557061851e-02f, -2.193102539e-01f,
+    -1.581138819e-01f, 4.362352192e-02f, 2.065857500e-01f, 1.859222502e-01f,
+    6.845983654e-17f, -1.859222502e-01f, -2.065857500e-01f, -4.362352192e-02f,
+    1.581138819e-01f, 1.581138819e-01f, 1.092590317e-01f, -1.168342307e-01f,
+    -2.234344035e-01f, -1.015153602e-01f, 1.242292821e-01f, 2.229174972e-01f,
+    9.361516684e-02f, -1.314327717e-01f, -2.220568508e-01f, -8.557061851e-02f,
+    1.384336203e-01f, 2.208538204e-01f, 1.581138819e-01f, 9.361516684e-02f,
+    -1.452209949e-01f, -2.152115405e-01f, -3.497980908e-02f, 1.859222502e-01f,
+    1.906561404e-01f, -2.628216147e-02f, -2.126626968e-01f, -1.517844647e-01f,
+    8.557061851e-02f, 2.234344035e-01f, 1.015153602e-01f, 1.581138819e-01f,
+    7.739412785e-02f, -1.700319499e-01f, -1.950960308e-01f, 3.497980908e-02f,
+    2.193102539e-01f, 1.168342307e-01f, -1.384336203e-01f, -2.126626968e-01f,
+    -8.778762072e-03f, 2.065857500e-01f, 1.517844647e-01f, -1.015153602e-01f,
+    1.581138819e-01f, 6.069593132e-02f, -1.906561404e-01f, -1.641995013e-01f,
+    1.015153602e-01f, 2.193102539e-01f, 1.754398644e-02f, -2.097859532e-01f,
+    -1.314327717e-01f, 1.384336203e-01f, 2.065857500e-01f, -2.628216147e-02f,
+    -2.208538204e-01f, 1.581138819e-01f, 4.362352192e-02f, -2.065857500e-01f,
+    -1.242292821e-01f, 1.581138819e-01f, 1.859222502e-01f, -8.557061851e-02f,
+    -2.193102539e-01f, -9.584376983e-17f, 2.193102539e-01f, 8.557061851e-02f,
+    -1.859222502e-01f, -1.581138819e-01f, 1.581138819e-01f, 2.628216147e-02f,
+    -2.174285203e-01f, -7.739412785e-02f, 1.992351115e-01f, 1.242292821e-01f,
+    -1.700319499e-01f, -1.641995013e-01f, 1.314327717e-01f, 1.950960308e-01f,
+    -8.557061851e-02f, -2.152115405e-01f, 3.497980908e-02f, 1.581138819e-01f,
+    8.778762072e-03f, -2.229174972e-01f, -2.628216147e-02f, 2.208538204e-01f,
+    4.362352192e-02f, -2.174285203e-01f, -6.069593132e-02f, 2.126626968e-01f,
+    7.739412785e-02f, -2.065857500e-01f, -9.361516684e-02f, 1.992351115e-01f,
+    1.581138819e-01f, -8.778762072e-03f, -2.229174972e-01f, 2.628216147e-02f,
+    2.208538204e-01f, -4.362352192e-02f, -2.174285203e-01f, 6.069593132e-02f,
+    2.126626968e-01f, -7.739412785e-02f, -2.065857500e-01f, 9.361516684e-02f,
+    1.992351115e-01f, 1.581138819e-01f, -2.628216147e-02f, -2.174285203e-01f,
+    7.739412785e-02f, 1.992351115e-01f, -1.242292821e-01f, -1.700319499e-01f,
+    1.641995013e-01f, 1.314327717e-01f, -1.950960308e-01f, -8.557061851e-02f,
+    2.152115405e-01f, 3.497980908e-02f, 1.581138819e-01f, -4.362352192e-02f,
+    -2.065857500e-01f, 1.242292821e-01f, 1.581138819e-01f, -1.859222502e-01f,
+    -8.557061851e-02f, 2.193102539e-01f, 1.232277031e-16f, -2.193102539e-01f,
+    8.557061851e-02f, 1.859222502e-01f, -1.581138819e-01f, 1.581138819e-01f,
+    -6.069593132e-02f, -1.906561404e-01f, 1.641995013e-01f, 1.015153602e-01f,
+    -2.193102539e-01f, 1.754398644e-02f, 2.097859532e-01f, -1.314327717e-01f,
+    -1.384336203e-01f, 2.065857500e-01f, 2.628216147e-02f, -2.208538204e-01f,
+    1.581138819e-01f, -7.739412785e-02f, -1.700319499e-01f, 1.950960308e-01f,
+    3.497980908e-02f, -2.193102539e-01f, 1.168342307e-01f, 1.384336203e-01f,
+    -2.126626968e-01f, 8.778762072e-03f, 2.065857500e-01f, -1.517844647e-01f,
+    -1.015153602e-01f, 1.581138819e-01f, -9.361516684e-02f, -1.452209949e-01f,
+    2.152115405e-01f, -3.497980908e-02f, -1.859222502e-01f, 1.906561404e-01f,
+    2.628216147e-02f, -2.126626968e-01f, 1.517844647e-01f, 8.557061851e-02f,
+    -2.234344035e-01f, 1.015153602e-01f, 1.581138819e-01f, -1.092590317e-01f,
+    -1.168342307e-01f, 2.234344035e-01f, -1.015153602e-01f, -1.242292821e-01f,
+    2.229174972e-01f, -9.361516684e-02f, -1.314327717e-01f, 2.220568508e-01f,
+    -8.557061851e-02f, -1.384336203e-01f, 2.208538204e-01f, 1.581138819e-01f,
+    -1.242292821e-01f, -8.557061851e-02f, 2.193102539e-01f, -1.581138819e-01f,
+    -4.362352192e-02f, 2.065857500e-01f, -1.859222502e-01f, 2.465938167e-16f,
+    1.859222502e-01f, -2.065857500e-01f, 4.362352192e-02f, 1.581138819e-01f,
+    1.581138819e-01f, -1.384336203e-01f, -5.219997093e-02f, 2.030669898e-01f,
+    -1.992351115e-01f, 4.362352192e-02f, 1.452209949e-01f, -2.234344035e-01f,
+    1.314327717e-01f, 6.069593132e-02f, -2.065857500e-01f, 1.950960308e-01f,
+    -3.497980908e-02f, 1.581138819e-01f, -1.517844647e-01f, -1.754398644e-02f,
+    1.756021976e-01f, -2.208538204e-01f, 1.242292821e-01f, 5.219997093e-02f,
+    -1.950960308e-01f, 2.126626968e-01f, -9.361516684e-02f, -8.557061851e-02f,
+    2.097859532e-01f, -1.992351115e-01f, 1.581138819e-01f, -1.641995013e-01f,
+    1.754398644e-02f, 1.384336203e-01f, -2.208538204e-01f, 1.859222502e-01f,
+    -5.219997093e-02f, -1.092590317e-01f, 2.126626968e-01f, -2.030669898e-01f,
+    8.557061851e-02f, 7.739412785e-02f, -1.992351115e-01f, 1.581138819e-01f,
+    -1.756021976e-01f, 5.219997093e-02f, 9.361516684e-02f, -1.992351115e-01f,
+    2.193102539e-01f, -1.452209949e-01f, 8.778762072e-03f, 1.314327717e-01f,
+    -2.152115405e-01f, 2.065857500e-01f, -1.092590317e-01f, -3.497980908e-02f,
+    1.581138819e-01f, -1.859222502e-01f, 8.557061851e-02f, 4.362352192e-02f,
+    -1.581138819e-01f, 2.193102539e-01f, -2.065857500e-01f, 1.242292821e-01f,
+    5.752010162e-16f, -1.242292821e-01f, 2.065857500e-01f, -2.193102539e-01f,
+    1.581138819e-01f, 1.581138819e-01f, -1.950960308e-01f, 1.168342307e-01f,
+    -8.778762072e-03f, -1.015153602e-01f, 1.859222502e-01f, -2.229174972e-01f,
+    2.030669898e-01f, -1.314327717e-01f, 2.628216147e-02f, 8.557061851e-02f,
+    -1.756021976e-01f, 2.208538204e-01f, 1.581138819e-01f, -2.030669898e-01f,
+    1.452209949e-01f, -6.069593132e-02f, -3.497980908e-02f, 1.242292821e-01f,
+    -1.906561404e-01f, 2.220568508e-01f, -2.126626968e-01f, 1.641995013e-01f,
+    -8.557061851e-02f, -8.778762072e-03f, 1.015153602e-01f, 1.581138819e-01f,
+    -2.097859532e-01f, 1.700319499e-01f, -1.092590317e-01f, 3.497980908e-02f,
+    4.362352192e-02f, -1.168342307e-01f, 1.756021976e-01f, -2.126626968e-01f,
+    2.234344035e-01f, -2.065857500e-01f, 1.641995013e-01f, -1.015153602e-01f,
+    1.581138819e-01f, -2.152115405e-01f, 1.906561404e-01f, -1.517844647e-01f,
+    1.015153602e-01f, -4.362352192e-02f, -1.754398644e-02f, 7.739412785e-02f,
+    -1.314327717e-01f, 1.756021976e-01f, -2.065857500e-01f, 2.220568508e-01f,
+    -2.208538204e-01f, 1.581138819e-01f, -2.193102539e-01f, 2.065857500e-01f,
+    -1.859222502e-01f, 1.581138819e-01f, -1.242292821e-01f, 8.557061851e-02f,
+    -4.362352192e-02f, -6.025849561e-16f, 4.362352192e-02f, -8.557061851e-02f,
+    1.242292821e-01f, -1.581138819e-01f, 1.581138819e-01f, -2.220568508e-01f,
+    2.174285203e-01f, -2.097859532e-01f, 1.992351115e-01f, -1.859222502e-01f,
+    1.700319499e-01f, -1.517844647e-01f, 1.314327717e-01f, -1.092590317e-01f,
+    8.557061851e-02f, -6.069593132e-02f, 3.497980908e-02f, 1.581138819e-01f,
+    -2.234344035e-01f, 2.229174972e-01f, -2.220568508e-01f, 2.208538204e-01f,
+    -2.193102539e-01f, 2.174285203e-01f, -2.152115405e-01f, 2.126626968e-01f,
+    -2.097859532e-01f, 2.065857500e-01f, -2.030669898e-01f, 1.992351115e-01f,
+};
+
+static const q15_t MFCC_DCT_COEFS_Q15[520] = {
+    5181, 5181, 5181, 5181, 5181, 5181, 5181, 5181,
+    5181, 5181, 5181, 5181, 5181, 5181, 5181, 5181,
+    5181, 5181, 5181, 5181, 5181, 5181, 5181, 5181,
+    5181, 5181, 5181, 5181, 5181, 5181, 5181, 5181,
+    5181, 5181, 5181, 5181, 5181, 5181, 5181, 5181,
+    7321, 7276, 7186, 7052, 6874, 6654, 6393, 6092,
+    5754, 5380, 4974, 4536, 4071, 3580, 3068, 2536,
+    1989, 1429, 861, 288, -288, -861, -1429, -1989,
+    -2536, -3068, -3580, -4071, -4536, -4974, -5380, -5754,
+    -6092, -6393, -6654, -6874, -7052, -7186, -7276, -7321,
+    7305, 7125, 6769, 6247, 5572, 4759, 3828, 2804,
+    1710, 575, -575, -1710, -2804, -3828, -4759, -5572,
+    -6247, -6769, -7125, -7305, -7305, -7125, -6769, -6247,
+    -5572, -4759, -3828, -2804, -1710, -575, 575, 1710,
+    2804, 3828, 4759, 5572, 6247, 6769, 7125, 7305,
+    7276, 6874, 6092, 4974, 3580, 1989, 288, -1429,
+    -3068, -4536, -5754, -6654, -7186, -7321, -7052, -6393,
+    -5380, -4071, -2536, -861, 861, 2536, 4071, 5380,
+    6393, 7052, 7321, 7186, 6654, 5754, 4536, 3068,
+    1429, -288, -1989, -3580, -4974, -6092, -6874, -7276,
+    7237, 6529, 5181, 3326, 1146, -1146, -3326, -5181,
+    -6529, -7237, -7237, -6529, -5181, -3326, -1146, 1146,
+    3326, 5181, 6529, 7237, 7237, 6529, 5181, 3326,
+    1146, -1146, -3326, -5181, -6529, -7237, -7237, -6529,
+    -5181, -3326, -1146, 1146, 3326, 5181, 6529, 7237,
+    7186, 6092, 4071, 1429, -1429, -4071, -6092, -7186,
+    -7186, -6092, -4071, -1429, 1429, 4071, 6092, 7186,
+    7186, 6092, 4071, 1429, -1429, -4071, -6092, -7186,
+    -7186, -6092, -4071, -1429, 1429, 4071, 6092, 7186,
+    7186, 6092, 4071, 1429, -1429, -4071, -6092, -7186,
+    7125, 5572, 2804, -575, -3828, -6247, -7305, -6769,
+    -4759, -1710, 1710, 4759, 6769, 7305, 6247, 3828,
+    575, -2804, -5572, -7125, -7125, -5572, -2804, 575,
+    3828, 6247, 7305, 6769, 4759, 1710, -1710, -4759,
+    -6769, -7305, -6247, -3828, -575, 2804, 5572, 7125,
+    7052, 4974, 1429, -2536, -5754, -7276, -6654, -4071,
+    -288, 3580, 6393, 7321, 6092, 3068, -861, -4536,
+    -6874, -7186, -5380, -1989, 1989, 5380, 7186, 6874,
+    4536, 861, -3068, -6092, -7321, -6393, -3580, 288,
+    4071, 6654, 7276, 5754, 2536, -1429, -4974, -7052,
+    6969, 4307, 0, -4307, -6969, -6969, -4307, 0,
+    4307, 6969, 6969, 4307, 0, -4307, -6969, -6969,
+    -4307, 0, 4307, 6969, 6969, 4307, 0, -4307,
+    -6969, -6969, -4307, 0, 4307, 6969, 6969, 4307,
+    0, -4307, -6969, -6969, -4307, 0, 4307, 6969,
+    6874, 3580, -1429, -5754, -7321, -5380, -861, 4071,
+    7052, 6654, 3068, -1989, -6092, -7276, -4974, -288,
+    4536, 7186, 6393, 2536, -2536, -6393, -7186, -4536,
+    288, 4974, 7276, 6092, 1989, -3068, -6654, -7052,
+    -4071, 861, 5380, 7321, 5754, 1429, -3580, -6874,
+    6769, 2804, -2804, -6769, -6769, -2804, 2804, 6769,
+    6769, 2804, -2804, -6769, -6769, -2804, 2804, 6769,
+    6769, 2804, -2804, -6769, -6769, -2804, 2804, 6769,
+    6769, 2804, -2804, -6769, -6769, -2804, 2804, 6769,
+    6769, 2804, -2804, -6769, -6769, -2804, 2804, 6769,
+    6654, 1989, -4071, -7276, -5380, 288, 5754, 7186,
+    3580, -2536, -6874, -6393, -1429, 4536, 7321, 4974,
+    -861, -6092, -7052, -3068, 3068, 7052, 6092, 861,
+    -4974, -7321, -4536, 1429, 6393, 6874, 2536, -3580,
+    -7186, -5754, -288, 5380, 7276, 4071, -1989, -6654,
+    6529, 1146, -5181, -7237, -3326, 3326, 7237, 5181,
+    -1146, -6529, -6529, -1146, 5181, 7237, 3326, -3326,
+    -7237, -5181, 1146, 6529, 6529, 1146, -5181, -7237,
+    -3326, 3326, 7237, 5181, -1146, -6529, -6529, -1146,
+    5181, 7237, 3326, -3326, -7237, -5181, 1146, 6529,
+};
+
+static const int32_t MFCC_LOG2_LUT_Q16[65] = {
+    0, 1466, 2909, 4331, 5732, 7112, 8473, 9814,
+    11136, 12440, 13727, 14996, 16248, 17484, 18704, 19909,
+    21098, 22272, 23433, 24579, 25711, 26830, 27936, 29029,
+    30109, 31178, 32234, 33279, 34312, 35334, 36346, 37346,
+    38336, 39316, 40286, 41246, 42196, 43137, 44068, 44990,
+    45904, 46809, 47705, 48593, 49472, 50344, 51207, 52063,
+    52911, 53751, 54584, 55410, 56229, 57040, 57845, 58643,
+    59434, 60219, 60997, 61769, 62534, 63294, 64047, 64794,
+    65536,
+};
+
+/* ---- 8000 Hz ---- */
+#define MFCC8K_SAMPLE_RATE 8000
+#define MFCC8K_FRAME_LEN 400
+#define MFCC8K_FRAME_SHIFT 160
+#define MFCC8K_FFT_LEN 512
+#define MFCC8K_FFT_LOG2_LEN 9
+#define MFCC8K_FMIN_HZ 0
+#define MFCC8K_FMAX_HZ 4000
+#define MFCC8K_FILTER_COEFS 456
+
+static const float32_t MFCC8K_HPF_COEFS_F32[5] = {
+    9.672272827e-01f, -1.934454565e+00f, 9.672272827e-01f, 1.933380226e+00f, -9.355289050e-01f,
+};
+
+static const uint32_t MFCC8K_FILTER_POS[40] = {
+    1, 3, 5, 7, 10, 12, 15, 18,
+    21, 24, 27, 30, 34, 38, 42, 46,
+    50, 54, 59, 64, 69, 75, 80, 86,
+    92, 99, 106, 113, 120, 128, 136, 145,
+    154, 163, 173, 184, 195, 206, 218, 230,
+};
+
+static const uint32_t MFCC8K_FILTER_LEN[40] = {
+    3, 3, 4, 4, 4, 5, 5, 5,
+    5, 5, 6, 7, 7, 7, 7, 7,
+    8, 9, 9, 10, 10, 10, 11, 12,
+    13, 13, 13, 14, 15, 16, 17, 17,
+    18, 20, 21, 21, 22, 23, 24, 26,
+};
+
+static const float32_t MFCC8K_FILTER_COEFS_F32[456] = {
+    5.000000000e-01f, 1.000000000e+00f, 5.000000000e-01f, 5.000000000e-01f,
+    1.000000000e+00f, 5.000000000e-01f, 5.000000000e-01f, 1.000000000e+00f,
+    6.666666865e-01f, 3.333333433e-01f, 3.333333433e-01f, 6.666666865e-01f,
+    1.000000000e+00f, 5.000000000e-01f, 5.000000000e-01f, 1.000000000e+00f,
+    6.666666865e-01f, 3.333333433e-01f, 3.333333433e-01f, 6.666666865e-01f,
+    1.000000000e+00f, 6.666666865e-01f, 3.333333433e-01f, 3.333333433e-01f,
+    6.666666865e-01f, 1.000000000e+00f, 6.666666865e-01f, 3.333333433e-01f,
+    3.333333433e-01f, 6.666666865e-01f, 1.000000000e+00f, 6.666666865e-01f,
+    3.333333433e-01f, 3.333333433e-01f, 6.666666865e-01f, 1.000000000e+00f,
+    6.666666865e-01f, 3.333333433e-01f, 3.333333433e-01f, 6.666666865e-01f,
+    1.000000000e+00f, 6.666666865e-01f, 3.333333433e-01f, 3.333333433e-01f,
+    6.666666865e-01f, 1.000000000e+00f, 7.500000000e-01f, 5.000000000e-01f,
+    2.500000000e-01f, 2.500000000e-01f, 5.000000000e-01f, 7.500000000e-01f,
+    1.000000000e+00f, 7.500000000e-01f, 5.000000000e-01f, 2.500000000e-01f,
+    2.500000000e-01f, 5.000000000e-01f, 7.500000000e-01f, 1.000000000e+00f,
+    7.500000000e-01f, 5.000000000e-01f, 2.500000000e-01f, 2.500000000e-01f,
+    5.000000000e-01f, 7.500000000e-01f, 1.000000000e+00f, 7.500000000e-01f,
+    5.000000000e-01f, 2.500000000e-01f, 2.500000000e-01f, 5.000000000e-01f,
+    7.500000000e-01f, 1.000000000e+00f, 7.500000000e-01f, 5.000000000e-01f,
+    2.500000000e-01f, 2.500000000e-01f, 5.000000000e-01f, 7.500000000e-01f,
+    1.000000000e+00f, 7.500000000e-01f, 5.000000000e-01f, 2.500000000e-01f,
+    2.500000000e-01f, 5.000000000e-01f, 7.500000000e-01f, 1.000000000e+00f,
+    8.000000119e-01f, 6.000000238e-01f, 4.000000060e-01f, 2.000000030e-01f,
+    2.000000030e-01f, 4.000000060e-01f, 6.000000238e-01f, 8.000000119e-01f,
+    1.000000000e+00f, 8.000000119e-01f, 6.000000238e-01f, 4.000000060e-01f,
+    2.000000030e-01f, 2.000000030e-01f, 4.000000060e-01f, 6.000000238e-01f,
+    8.000000119e-01f, 1.000000000e+00f, 8.000000119e-01f, 6.000000238e-01f,
+    4.000000060e-01f, 2.000000030e-01f, 2.000000030e-01f, 4.000000060e-01f,
+    6.000000238e-01f, 8.000000119e-01f, 1.000000000e+00f, 8.333333135e-01f,
+    6.666666865e-01f, 5.000000000e-01f, 3.333333433e-01f, 1.666666716e-01f,
+    1.666666716e-01f, 3.333333433e-01f, 5.000000000e-01f, 6.666666865e-01f,
+    8.333333135e-01f, 1.000000000e+00f, 8.000000119e-01f, 6.000000238e-01f,
+    4.000000060e-01f, 2.000000030e-01f, 2.000000030e-01f, 4.000000060e-01f,
+    6.000000238e-01f, 8.000000119e-01f, 1.000000000e+00f, 8.333333135e-01f,
+    6.666666865e-01f, 5.000000000e-01f, 3.333333433e-01f, 1.666666716e-01f,
+    1.666666716e-01f, 3.333333433e-01f, 5.000000000e-01f, 6.666666865e-01f,
+    8.333333135e-01f, 1.000000000e+00f, 8.333333135e-01f, 6.666666865e-01f,
+    5.000000000e-01f, 3.333333433e-01f, 1.666666716e-01f, 1.666666716e-01f,
+    3.333333433e-01f, 5.000000000e-01f, 6.666666865e-01f, 8.333333135e-01f,
+    1.000000000e+00f, 8.571428657e-01f, 7.142857313e-01f, 5.714285970e-01f,
+    4.285714328e-01f, 2.857142985e-01f, 1.428571492e-01f, 1.428571492e-01f,
+    2.857142985e-01f, 4.285714328e-01f, 5.714285970e-01f, 7.142857313e-01f,
+    8.571428657e-01f, 1.000000000e+00f, 8.571428657e-01f, 7.142857313e-01f,
+    5.714285970e-01f, 4.285714328e-01f, 2.857142985e-01f, 1.428571492e-01f,
+    1.428571492e-01f, 2.857142985e-01f, 4.285714328e-01f, 5.714285970e-01f,
+    7.142857313e-01f, 8.571428657e-01f, 1.000000000e+00f, 8.571428657e-01f,
+    7.142857313e-01f, 5.714285970e-01f, 4.285714328e-01f, 2.857142985e-01f,
+    1.428571492e-01f, 1.428571492e-01f, 2.857142985e-01f, 4.285714328e-01f,
+    5.714285970e-01f, 7.142857313e-01f, 8.571428657e-01f, 1.000000000e+00f,
+    8.571428657e-01f, 7.142857313e-01f, 5.714285970e-01f, 4.285714328e-01f,
+    2.857142985e-01f, 1.428571492e-01f, 1.428571492e-01f, 2.857142985e-01f,
+    4.285714328e-01f, 5.714285970e-01f, 7.142857313e-01f, 8.571428657e-01f,
+    1.000000000e+00f, 8.750000000e-01f, 7.500000000e-01f, 6.250000000e-01f,
+    5.000000000e-01f, 3.750000000e-01f, 2.500000000e-01f, 1.250000000e-01f,
+    1.250000000e-01f, 2.500000000e-01f, 3.750000000e-01f, 5.000000000e-01f,
+    6.250000000e-01f, 7.500000000e-01f, 8.750000000e-01f, 1.000000000e+00f,
+    8.750000000e-01f, 7.500000000e-01f, 6.250000000e-01f, 5.000000000e-01f,
+    3.750000000e-01f, 2.500000000e-01f, 1.250000000e-01f, 1.250000000e-01f,
+    2.500000000e-01f, 3.750000000e-01f, 5.000000000e-01f, 6.250000000e-01f,
+    7.500000000e-01f, 8.750000000e-01f, 1.000000000e+00f, 8.888888955e-01f,
+    7.777777910e-01f, 6.666666865e-01f, 5.555555820e-01f, 4.444444478e-01f,
+    3.333333433e-01f, 2.222222239e-01f, 1.111111119e-01f, 1.111111119e-01f,
+    2.222222239e-01f, 3.333333433e-01f, 4.444444478e-01f, 5.555555820e-01f,
+    6.666666865e-01f, 7.777777910e-01f, 8.888888955e-01f, 1.000000000e+00f,
+    8.888888955e-01f, 7.777777910e-01f, 6.666666865e-01f, 5.555555820e-01f,
+    4.444444478e-01f, 3.333333433e-01f, 2.222222239e-01f, 1.111111119e-01f,
+    1.111111119e-01f, 2.222222239e-01f, 3.333333433e-01f, 4.444444478e-01f,
+    5.555555820e-01f, 6.666666865e-01f, 7.777777910e-01f, 8.888888955e-01f,
+    1.000000000e+00f, 8.888888955e-01f, 7.777777910e-01f, 6.666666865e-01f,
+    5.555555820e-01f, 4.444444478e-01f, 3.333333433e-01f, 2.222222239e-01f,
+    1.111111119e-01f, 1.111111119e-01f, 2.222222239e-01f, 3.333333433e-01f,
+    4.444444478e-01f, 5.555555820e-01f, 6.666666865e-01f, 7.777777910e-01f,
+    8.888888955e-01f, 1.000000000e+00f, 8.999999762e-01f, 8.000000119e-01f,
+    6.999999881e-01f, 6.000000238e-01f, 5.000000000e-01f, 4.000000060e-01f,
+    3.000000119e-01f, 2.000000030e-01f, 1.000000015e-01f, 1.000000015e-01f,
+    2.000000030e-01f, 3.000000119e-01f, 4.000000060e-01f, 5.000000000e-01f,
+    6.000000238e-01f, 6.999999881e-01f, 8.000000119e-01f, 8.999999762e-01f,
+    1.000000000e+00f, 9.090909362e-01f, 8.181818128e-01f, 7.272727489e-01f,
+    6.363636255e-01f, 5.454545617e-01f, 4.545454681e-01f, 3.636363745e-01f,
+    2.727272809e-01f, 1.818181872e-01f, 9.090909362e-02f, 9.090909362e-02f,
+    1.818181872e-01f, 2.727272809e-01f, 3.636363745e-01f, 4.545454681e-01f,
+    5.454545617e-01f, 6.363636255e-01f, 7.272727489e-01f, 8.181818128e-01f,
+    9.090909362e-01f, 1.000000000e+00f, 9.090909362e-01f, 8.181818128e-01f,
+    7.272727489e-01f, 6.363636255e-01f, 5.454545617e-01f, 4.545454681e-01f,
+    3.636363745e-01f, 2.727272809e-01f, 1.818181872e-01f, 9.090909362e-02f,
+    9.090909362e-02f, 1.818181872e-01f, 2.727272809e-01f, 3.636363745e-01f,
+    4.545454681e-01f, 5.454545617e-01f, 6.363636255e-01f, 7.272727489e-01f,
+    8.181818128e-01f, 9.090909362e-01f, 1.000000000e+00f, 9.090909362e-01f,
+    8.181818128e-01f, 7.272727489e-01f, 6.363636255e-01f, 5.454545617e-01f,
+    4.545454681e-01f, 3.636363745e-01f, 2.727272809e-01f, 1.818181872e-01f,
+    9.090909362e-02f, 9.090909362e-02f, 1.818181872e-01f, 2.727272809e-01f,
+    3.636363745e-01f, 4.545454681e-01f, 5.454545617e-01f, 6.363636255e-01f,
+    7.272727489e-01f, 8.181818128e-01f, 9.090909362e-01f, 1.000000000e+00f,
+    9.166666865e-01f, 8.333333135e-01f, 7.500000000e-01f, 6.666666865e-01f,
+    5.833333135e-01f, 5.000000000e-01f, 4.166666567e-01f, 3.333333433e-01f,
+    2.500000000e-01f, 1.666666716e-01f, 8.333333582e-02f, 8.333333582e-02f,
+    1.666666716e-01f, 2.500000000e-01f, 3.333333433e-01f, 4.166666567e-01f,
+    5.000000000e-01f, 5.833333135e-01f, 6.666666865e-01f, 7.500000000e-01f,
+    8.333333135e-01f, 9.166666865e-01f, 1.000000000e+00f, 9.166666865e-01f,
+    8.333333135e-01f, 7.500000000e-01f, 6.666666865e-01f, 5.833333135e-01f,
+    5.000000000e-01f, 4.166666567e-01f, 3.333333433e-01f, 2.500000000e-01f,
+    1.666666716e-01f, 8.333333582e-02f, 8.333333582e-02f, 1.666666716e-01f,
+    2.500000000e-01f, 3.333333433e-01f, 4.166666567e-01f, 5.000000000e-01f,
+    5.833333135e-01f, 6.666666865e-01f, 7.500000000e-01f, 8.333333135e-01f,
+    9.166666865e-01f, 1.000000000e+00f, 9.230769277e-01f, 8.461538553e-01f,
+    7.692307830e-01f, 6.923077106e-01f, 6.153846383e-01f, 5.384615660e-01f,
+    4.615384638e-01f, 3.846153915e-01f, 3.076923192e-01f, 2.307692319e-01f,
+    1.538461596e-01f, 7.692307979e-02f, 7.692307979e-02f, 1.538461596e-01f,
+    2.307692319e-01f, 3.076923192e-01f, 3.846153915e-01f, 4.615384638e-01f,
+    5.384615660e-01f, 6.153846383e-01f, 6.923077106e-01f, 7.692307830e-01f,
+    8.461538553e-01f, 9.230769277e-01f, 1.000000000e+00f, 9.285714030e-01f,
+    8.571428657e-01f, 7.857142687e-01f, 7.142857313e-01f, 6.428571343e-01f,
+    5.714285970e-01f, 5.000000000e-01f, 4.285714328e-01f, 3.571428657e-01f,
+    2.857142985e-01f, 2.142857164e-01f, 1.428571492e-01f, 7.142857462e-02f,
+};
+
+static const q15_t MFCC8K_FILTER_COEFS_Q15[456] = {
+    16384, 32767, 16384, 16384, 32767, 16384, 16384, 32767,
+    21845, 10923, 10923, 21845, 32767, 16384, 16384, 32767,
+    21845, 10923, 10923, 21845, 32767, 21845, 10923, 10923,
+    21845, 32767, 21845, 10923, 10923, 21845, 32767, 21845,
+    10923, 10923, 21845, 32767, 21845, 10923, 10923, 21845,
+    32767, 21845, 10923, 10923, 21845, 32767, 24576, 16384,
+    8192, 8192, 16384, 24576, 32767, 24576, 16384, 8192,
+    8192, 16384, 24576, 32767, 24576, 16384, 8192, 8192,
+    16384, 24576, 32767, 24576, 16384, 8192, 8192, 16384,
+    24576, 32767, 24576, 16384, 8192, 8192, 16384, 24576,
+    32767, 24576, 16384, 8192, 8192, 16384, 24576, 32767,
+    26214, 19661, 13107, 6554, 6554, 13107, 19661, 26214,
+    32767, 26214, 19661, 13107, 6554, 6554, 13107, 19661,
+    26214, 32767, 26214, 19661, 13107, 6554, 6554, 13107,
+    19661, 26214, 32767, 27307, 21845, 16384, 10923, 5461,
+    5461, 10923, 16384, 21845, 27307, 32767, 26214, 19661,
+    13107, 6554, 6554, 13107, 19661, 26214, 32767, 27307,
+    21845, 16384, 10923, 5461, 5461, 10923, 16384, 21845,
+    27307, 32767, 27307, 21845, 16384, 10923, 5461, 5461,
+    10923, 16384, 21845, 27307, 32767, 28087, 23406, 18725,
+    14043, 9362, 4681, 4681, 9362, 14043, 18725, 23406,
+    28087, 32767, 28087, 23406, 18725, 14043, 9362, 4681,
+    4681, 9362, 14043, 18725, 23406, 28087, 32767, 28087,
+    23406, 18725, 14043, 9362, 4681, 4681, 9362, 14043,
+    18725, 23406, 28087, 32767, 28087, 23406, 18725, 14043,
+    9362, 4681, 4681, 9362, 14043, 18725, 23406, 28087,
+    32767, 28672, 24576, 20480, 16384, 12288, 8192, 4096,
+    4096, 8192, 12288, 16384, 20480, 24576, 28672, 32767,
+    28672, 24576, 20480, 16384, 12288, 8192, 4096, 4096,
+    8192, 12288, 16384, 20480, 24576, 28672, 32767, 29127,
+    25486, 21845, 18204, 14564, 10923, 7282, 3641, 3641,
+    7282, 10923, 14564, 18204, 21845, 25486, 29127, 32767,
+    29127, 25486, 21845, 18204, 14564, 10923, 7282, 3641,
+    3641, 7282, 10923, 14564, 18204, 21845, 25486, 29127,
+    32767, 29127, 25486, 21845, 18204, 14564, 10923, 7282,
+    3641, 3641, 7282, 10923, 14564, 18204, 21845, 25486,
+    29127, 32767, 29491, 26214, 22938, 19661, 16384, 13107,
+    9830, 6554, 3277, 3277, 6554, 9830, 13107, 16384,
+    19661, 22938, 26214, 29491, 32767, 29789, 26810, 23831,
+    20852, 17873, 14895, 11916, 8937, 5958, 2979, 2979,
+    5958, 8937, 11916, 14895, 17873, 20852, 23831, 26810,
+    29789, 32767, 29789, 26810, 23831, 20852, 17873, 14895,
+    11916, 8937, 5958, 2979, 2979, 5958, 8937, 11916,
+    14895, 17873, 20852, 23831, 26810, 29789, 32767, 29789,
+    26810, 23831, 20852, 17873, 14895, 11916, 8937, 5958,
+    2979, 2979, 5958, 8937, 11916, 14895, 17873, 20852,
+    23831, 26810, 29789, 32767, 30037, 27307, 24576, 21845,
+    19115, 16384, 13653, 10923, 8192, 5461, 2731, 2731,
+    5461, 8192, 10923, 13653, 16384, 19115, 21845, 24576,
+    27307, 30037, 32767, 30037, 27307, 24576, 21845, 19115,
+    16384, 13653, 10923, 8192, 5461, 2731, 2731, 5461,
+    8192, 10923, 13653, 16384, 19115, 21845, 24576, 27307,
+    30037, 32767, 30247, 27727, 25206, 22686, 20165, 17644,
+    15124, 12603, 10082, 7562, 5041, 2521, 2521, 5041,
+    7562, 10082, 12603, 15124, 17644, 20165, 22686, 25206,
+    27727, 30247, 32767, 30427, 28087, 25746, 23406, 21065,
+    18725, 16384, 14043, 11703, 9362, 7022, 4681, 2341,
+};
+
+static const float32_t MFCC8K_WINDOW_F32[512] = {
+    7.999999821e-02f, 8.005703241e-02f, 8.022812009e-02f, 8.051321656e-02f,
+    8.091226220e-02f, 8.142513782e-02f, 8.205173165e-02f, 8.279188722e-02f,
+    8.364541829e-02f, 8.461210877e-02f, 8.569172770e-02f, 8.688399941e-02f,
+    8.818863332e-02f, 8.960530907e-02f, 9.113366157e-02f, 9.277332574e-02f,
+    9.452389181e-02f, 9.638492018e-02f, 9.835595638e-02f, 1.004365087e-01f,
+    1.026260629e-01f, 1.049240679e-01f, 1.073299646e-01f, 1.098431498e-01f,
+    1.124630049e-01f, 1.151888743e-01f, 1.180200875e-01f, 1.209559441e-01f,
+    1.239957064e-01f, 1.271386296e-01f, 1.303839236e-01f, 1.337307990e-01f,
+    1.371784210e-01f, 1.407259256e-01f, 1.443724483e-01f, 1.481170654e-01f,
+    1.519588679e-01f, 1.558968872e-01f, 1.599301696e-01f, 1.640576869e-01f,
+    1.682784259e-01f, 1.725913435e-01f, 1.769953668e-01f, 1.814894080e-01f,
+    1.860723495e-01f, 1.907430589e-01f, 1.955003738e-01f, 2.003431022e-01f,
+    2.052700669e-01f, 2.102800459e-01f, 2.153717726e-01f, 2.205440104e-01f,
+    2.257954478e-01f, 2.311248183e-01f, 2.365307659e-01f, 2.420119792e-01f,
+    2.475670725e-01f, 2.531946898e-01f, 2.588934302e-01f, 2.646618783e-01f,
+    2.704985738e-01f, 2.764021456e-01f, 2.823710442e-01f, 2.884038389e-01f,
+    2.944990396e-01f, 3.006550968e-01f, 3.068705201e-01f, 3.131437302e-01f,
+    3.194732368e-01f, 3.258574009e-01f, 3.322946429e-01f, 3.387834132e-01f,
+    3.453221023e-01f, 3.519090414e-01f, 3.585426211e-01f, 3.652212024e-01f,
+    3.719431162e-01f, 3.787067235e-01f, 3.855103254e-01f, 3.923522234e-01f,
+    3.992307186e-01f, 4.061441422e-01f, 4.130907655e-01f, 4.200688601e-01f,
+    4.270766675e-01f, 4.341124892e-01f, 4.411745965e-01f, 4.482611716e-01f,
+    4.553705156e-01f, 4.625008404e-01f, 4.696503878e-01f, 4.768173695e-01f,
+    4.840000272e-01f, 4.911965430e-01f, 4.984051883e-01f, 5.056241751e-01f,
+    5.128516555e-01f, 5.200858712e-01f, 5.273249745e-01f, 5.345672965e-01f,
+    5.418109298e-01f, 5.490541458e-01f, 5.562950969e-01f, 5.635319948e-01f,
+    5.707630515e-01f, 5.779864788e-01f, 5.852005482e-01f, 5.924033523e-01f,
+    5.995931625e-01f, 6.067681909e-01f, 6.139267087e-01f, 6.210668683e-01f,
+    6.281868815e-01f, 6.352850795e-01f, 6.423596144e-01f, 6.494088173e-01f,
+    6.564308405e-01f, 6.634240150e-01f, 6.703865528e-01f, 6.773167849e-01f,
+    6.842129827e-01f, 6.910734177e-01f, 6.978963614e-01f, 7.046802044e-01f,
+    7.114231586e-01f, 7.181236148e-01f, 7.247799039e-01f, 7.313903570e-01f,
+    7.379533648e-01f, 7.444673181e-01f, 7.509304881e-01f, 7.573414445e-01f,
+    7.636984587e-01f, 7.699999809e-01f, 7.762445211e-01f, 7.824304700e-01f,
+    7.885562778e-01f, 7.946204543e-01f, 8.006215096e-01f, 8.065578938e-01f,
+    8.124282360e-01f, 8.182309866e-01f, 8.239647150e-01f, 8.296281099e-01f,
+    8.352196217e-01f, 8.407379389e-01f, 8.461816907e-01f, 8.515495062e-01f,
+    8.568400741e-01f, 8.620520830e-01f, 8.671842217e-01f, 8.722352386e-01f,
+    8.772038817e-01f, 8.820888400e-01f, 8.868890405e-01f, 8.916031718e-01f,
+    8.962301612e-01f, 9.007688165e-01f, 9.052179456e-01f, 9.095765948e-01f,
+    9.138435125e-01f, 9.180178046e-01f, 9.220983386e-01f, 9.260841012e-01f,
+    9.299741387e-01f, 9.337674379e-01f, 9.374631047e-01f, 9.410602450e-01f,
+    9.445579052e-01f, 9.479552507e-01f, 9.512514472e-01f, 9.544456601e-01f,
+    9.575371146e-01f, 9.605250359e-01f, 9.634086490e-01f, 9.661872983e-01f,
+    9.688602090e-01f, 9.714268446e-01f, 9.738864303e-01f, 9.762384295e-01f,
+    9.784823060e-01f, 9.806174040e-01f, 9.826433063e-01f, 9.845593572e-01f,
+    9.863651991e-01f, 9.880604148e-01f, 9.896444678e-01f, 9.911170006e-01f,
+    9.924777150e-01f, 9.937261939e-01f, 9.948621988e-01f, 9.958853722e-01f,
+    9.967955351e-01f, 9.975923896e-01f, 9.982757568e-01f, 9.988455176e-01f,
+    9.993014932e-01f, 9.996435642e-01f, 9.998716712e-01f, 9.999857545e-01f,
+    9.999857545e-01f, 9.998716712e-01f, 9.996435642e-01f, 9.993014932e-01f,
+    9.988455176e-01f, 9.982757568e-01f, 9.975923896e-01f, 9.967955351e-01f,
+    9.958853722e-01f, 9.948621988e-01f, 9.937261939e-01f, 9.924777150e-01f,
+    9.911170006e-01f, 9.896444678e-01f, 9.880604148e-01f, 9.863651991e-01f,
+    9.845593572e-01f, 9.826433063e-01f, 9.806174040e-01f, 9.784823060e-01f,
+    9.762384295e-01f, 9.738864303e-01f, 9.714268446e-01f, 9.688602090e-01f,
+    9.661872983e-01f, 9.634086490e-01f, 9.605250359e-01f, 9.575371146e-01f,
+    9.544456601e-01f, 9.512514472e-01f, 9.479552507e-01f, 9.445579052e-01f,
+    9.410602450e-01f, 9.374631047e-01f, 9.337674379e-01f, 9.299741387e-01f,
+    9.260841012e-01f, 9.220983386e-01f, 9.180178046e-01f, 9.138435125e-01f,
+    9.095765948e-01f, 9.052179456e-01f, 9.007688165e-01f, 8.962301612e-01f,
+    8.916031718e-01f, 8.868890405e-01f, 8.820888400e-01f, 8.772038817e-01f,
+    8.722352386e-01f, 8.671842217e-01f, 8.620520830e-01f, 8.568400741e-01f,
+    8.515495062e-01f, 8.461816907e-01f, 8.407379389e-01f, 8.352196217e-01f,
+    8.296281099e-01f, 8.239647150e-01f, 8.182309866e-01f, 8.124282360e-01f,
+    8.065578938e-01f, 8.006215096e-01f, 7.946204543e-01f, 7.885562778e-01f,
+    7.824304700e-01f, 7.762445211e-01f, 7.699999809e-01f, 7.636984587e-01f,
+    7.573414445e-01f, 7.509304881e-01f, 7.444673181e-01f, 7.379533648e-01f,
+    7.313903570e-01f, 7.247799039e-01f, 7.181236148e-01f, 7.114231586e-01f,
+    7.046802044e-01f, 6.978963614e-01f, 6.910734177e-01f, 6.842129827e-01f,
+    6.773167849e-01f, 6.703865528e-01f, 6.634240150e-01f, 6.564308405e-01f,
+    6.494088173e-01f, 6.423596144e-01f, 6.352850795e-01f, 6.281868815e-01f,
+    6.210668683e-01f, 6.139267087e-01f, 6.067681909e-01f, 5.995931625e-01f,
+    5.924033523e-01f, 5.852005482e-01f, 5.779864788e-01f, 5.707630515e-01f,
+    5.635319948e-01f, 5.562950969e-01f, 5.490541458e-01f, 5.418109298e-01f,
+    5.345672965e-01f, 5.273249745e-01f, 5.200858712e-01f, 5.128516555e-01f,
+    5.056241751e-01f, 4.984051883e-01f, 4.911965430e-01f, 4.840000272e-01f,
+    4.768173695e-01f, 4.696503878e-01f, 4.625008404e-01f, 4.553705156e-01f,
+    4.482611716e-01f, 4.411745965e-01f, 4.341124892e-01f, 4.270766675e-01f,
+    4.200688601e-01f, 4.130907655e-01f, 4.061441422e-01f, 3.992307186e-01f,
+    3.923522234e-01f, 3.855103254e-01f, 3.787067235e-01f, 3.719431162e-01f,
+    3.652212024e-01f, 3.585426211e-01f, 3.519090414e-01f, 3.453221023e-01f,
+    3.387834132e-01f, 3.322946429e-01f, 3.258574009e-01f, 3.194732368e-01f,
+    3.131437302e-01f, 3.068705201e-01f, 3.006550968e-01f, 2.944990396e-01f,
+    2.884038389e-01f, 2.823710442e-01f, 2.764021456e-01f, 2.704985738e-01f,
+    2.646618783e-01f, 2.588934302e-01f, 2.531946898e-01f, 2.475670725e-01f,
+    2.420119792e-01f, 2.365307659e-01f, 2.311248183e-01f, 2.257954478e-01f,
+    2.205440104e-01f, 2.153717726e-01f, 2.102800459e-01f, 2.052700669e-01f,
+    2.003431022e-01f, 1.955003738e-01f, 1.907430589e-01f, 1.860723495e-01f,
+    1.814894080e-01f, 1.769953668e-01f, 1.725913435e-01f, 1.682784259e-01f,
+    1.640576869e-01f, 1.599301696e-01f, 1.558968872e-01f, 1.519588679e-01f,
+    1.481170654e-01f, 1.443724483e-01f, 1.407259256e-01f, 1.371784210e-01f,
+    1.337307990e-01f, 1.303839236e-01f, 1.271386296e-01f, 1.239957064e-01f,
+    1.209559441e-01f, 1.180200875e-01f, 1.151888743e-01f, 1.124630049e-01f,
+    1.098431498e-01f, 1.073299646e-01f, 1.049240679e-01f, 1.026260629e-01f,
+    1.004365087e-01f, 9.835595638e-02f, 9.638492018e-02f, 9.452389181e-02f,
+    9.277332574e-02f, 9.113366157e-02f, 8.960530907e-02f, 8.818863332e-02f,
+    8.688399941e-02f, 8.569172770e-02f, 8.461210877e-02f, 8.364541829e-02f,
+    8.279188722e-02f, 8.205173165e-02f, 8.142513782e-02f, 8.091226220e-02f,
+    8.051321656e-02f, 8.022812009e-02f, 8.005703241e-02f, 7.999999821e-02f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+};
+
+static const q15_t MFCC8K_WINDOW_Q15[512] = {
+    2621, 2623, 2629, 2638, 2651, 2668, 2689, 2713,
+    2741, 2773, 2808, 2847, 2890, 2936, 2986, 3040,
+    3097, 3158, 3223, 3291, 3363, 3438, 3517, 3599,
+    3685, 3775, 3867, 3963, 4063, 4166, 4272, 4382,
+    4495, 4611, 4731, 4854, 4979, 5108, 5241, 5376,
+    5514, 5655, 5800, 5947, 6097, 6250, 6406, 6565,
+    6726, 6890, 7057, 7227, 7399, 7573, 7751, 7930,
+    8112, 8297, 8483, 8672, 8864, 9057, 9253, 9450,
+    9650, 9852, 10056, 10261, 10468, 10678, 10889, 11101,
+    11316, 11531, 11749, 11968, 12188, 12409, 12632, 12857,
+    13082, 13309, 13536, 13765, 13994, 14225, 14456, 14689,
+    14922, 15155, 15390, 15624, 15860, 16096, 16332, 16568,
+    16805, 17042, 17279, 17517, 17754, 17991, 18229, 18466,
+    18703, 18939, 19176, 19412, 19647, 19883, 20117, 20351,
+    20584, 20817, 21049, 21280, 21510, 21739, 21967, 22194,
+    22420, 22645, 22869, 23091, 23312, 23531, 23750, 23966,
+    24181, 24395, 24606, 24817, 25025, 25231, 25436, 25639,
+    25839, 26038, 26235, 26429, 26622, 26812, 27000, 27185,
+    27368, 27549, 27728, 27904, 28077, 28248, 28416, 28581,
+    28744, 28904, 29062, 29216, 29368, 29516, 29662, 29805,
+    29945, 30082, 30215, 30346, 30473, 30598, 30719, 30837,
+    30951, 31063, 31171, 31275, 31377, 31474, 31569, 31660,
+    31748, 31832, 31912, 31989, 32063, 32133, 32199, 32262,
+    32321, 32377, 32429, 32477, 32522, 32562, 32600, 32633,
+    32663, 32689, 32712, 32730, 32745, 32756, 32764, 32767,
+    32767, 32764, 32756, 32745, 32730, 32712, 32689, 32663,
+    32633, 32600, 32562, 32522, 32477, 32429, 32377, 32321,
+    32262, 32199, 32133, 32063, 31989, 31912, 31832, 31748,
+    31660, 31569, 31474, 31377, 31275, 31171, 31063, 30951,
+    30837, 30719, 30598, 30473, 30346, 30215, 30082, 29945,
+    29805, 29662, 29516, 29368, 29216, 29062, 28904, 28744,
+    28581, 28416, 28248, 28077, 27904, 27728, 27549, 27368,
+    27185, 27000, 26812, 26622, 26429, 26235, 26038, 25839,
+    25639, 25436, 25231, 25025, 24817, 24606, 24395, 24181,
+    23966, 23750, 23531, 23312, 23091, 22869, 22645, 22420,
+    22194, 21967, 21739, 21510, 21280, 21049, 20817, 20584,
+    20351, 20117, 19883, 19647, 19412, 19176, 18939, 18703,
+    18466, 18229, 17991, 17754, 17517, 17279, 17042, 16805,
+    16568, 16332, 16096, 15860, 15624, 15390, 15155, 14922,
+    14689, 14456, 14225, 13994, 13765, 13536, 13309, 13082,
+    12857, 12632, 12409, 12188, 11968, 11749, 11531, 11316,
+    11101, 10889, 10678, 10468, 10261, 10056, 9852, 9650,
+    9450, 9253, 9057, 8864, 8672, 8483, 8297, 8112,
+    7930, 7751, 7573, 7399, 7227, 7057, 6890, 6726,
+    6565, 6406, 6250, 6097, 5947, 5800, 5655, 5514,
+    5376, 5241, 5108, 4979, 4854, 4731, 4611, 4495,
+    4382, 4272, 4166, 4063, 3963, 3867, 3775, 3685,
+    3599, 3517, 3438, 3363, 3291, 3223, 3158, 3097,
+    3040, 2986, 2936, 2890, 2847, 2808, 2773, 2741,
+    2713, 2689, 2668, 2651, 2638, 2629, 2623, 2621,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/* ---- 16000 Hz ---- */
+#define MFCC16K_SAMPLE_RATE 16000
+#define MFCC16K_FRAME_LEN 512
+#define MFCC16K_FRAME_SHIFT 320
+#define MFCC16K_FFT_LEN 512
+#define MFCC16K_FFT_LOG2_LEN 9
+#define MFCC16K_FMIN_HZ 100
+#define MFCC16K_FMAX_HZ 7600
+#define MFCC16K_FILTER_COEFS 424
+
+static const float32_t MFCC16K_HPF_COEFS_F32[5] = {
+    9.834772034e-01f, -1.966954407e+00f, 9.834772034e-01f, 1.966681385e+00f, -9.672274282e-01f,
+};
+
+static const uint32_t MFCC16K_FILTER_POS[40] = {
+    4, 5, 7, 8, 10, 12, 14, 16,
+    19, 21, 23, 26, 29, 32, 35, 38,
+    42, 46, 50, 54, 58, 63, 68, 73,
+    79, 85, 91, 98, 105, 112, 120, 128,
+    137, 147, 157, 167, 178, 190, 202, 215,
+};
+
+static const uint32_t MFCC16K_FILTER_LEN[40] = {
+    2, 2, 2, 3, 3, 3, 4, 4,
+    3, 4, 5, 5, 5, 5, 6, 7,
+    7, 7, 7, 8, 9, 9, 10, 11,
+    11, 12, 13, 13, 14, 15, 16, 18,
+    19, 19, 20, 22, 23, 24, 26, 28,
+};
+
+static const float32_t MFCC16K_FILTER_COEFS_F32[424] = {
+    1.000000000e+00f, 5.000000000e-01f, 5.000000000e-01f, 1.000000000e+00f,
+    1.000000000e+00f, 5.000000000e-01f, 5.000000000e-01f, 1.000000000e+00f,
+    5.000000000e-01f, 5.000000000e-01f, 1.000000000e+00f, 5.000000000e-01f,
+    5.000000000e-01f, 1.000000000e+00f, 5.000000000e-01f, 5.000000000e-01f,
+    1.000000000e+00f, 6.666666865e-01f, 3.333333433e-01f, 3.333333433e-01f,
+    6.666666865e-01f, 1.000000000e+00f, 5.000000000e-01f, 5.000000000e-01f,
+    1.000000000e+00f, 5.000000000e-01f, 5.000000000e-01f, 1.000000000e+00f,
+    6.666666865e-01f, 3.333333433e-01f, 3.333333433e-01f, 6.666666865e-01f,
+    1.000000000e+00f, 6.666666865e-01f, 3.333333433e-01f, 3.333333433e-01f,
+    6.666666865e-01f, 1.000000000e+00f, 6.666666865e-01f, 3.333333433e-01f,
+    3.333333433e-01f, 6.666666865e-01f, 1.000000000e+00f, 6.666666865e-01f,
+    3.333333433e-01f, 3.333333433e-01f, 6.666666865e-01f, 1.000000000e+00f,
+    6.666666865e-01f, 3.333333433e-01f, 3.333333433e-01f, 6.666666865e-01f,
+    1.000000000e+00f, 7.500000000e-01f, 5.000000000e-01f, 2.500000000e-01f,
+    2.500000000e-01f, 5.000000000e-01f, 7.500000000e-01f, 1.000000000e+00f,
+    7.500000000e-01f, 5.000000000e-01f, 2.500000000e-01f, 2.500000000e-01f,
+    5.000000000e-01f, 7.500000000e-01f, 1.000000000e+00f, 7.500000000e-01f,
+    5.000000000e-01f, 2.500000000e-01f, 2.500000000e-01f, 5.000000000e-01f,
+    7.500000000e-01f, 1.000000000e+00f, 7.500000000e-01f, 5.000000000e-01f,
+    2.500000000e-01f, 2.500000000e-01f, 5.000000000e-01f, 7.500000000e-01f,
+    1.000000000e+00f, 7.500000000e-01f, 5.000000000e-01f, 2.500000000e-01f,
+    2.500000000e-01f, 5.000000000e-01f, 7.500000000e-01f, 1.000000000e+00f,
+    8.000000119e-01f, 6.000000238e-01f, 4.000000060e-01f, 2.000000030e-01f,
+    2.000000030e-01f, 4.000000060e-01f, 6.000000238e-01f, 8.000000119e-01f,
+    1.000000000e+00f, 8.000000119e-01f, 6.000000238e-01f, 4.000000060e-01f,
+    2.000000030e-01f, 2.000000030e-01f, 4.000000060e-01f, 6.000000238e-01f,
+    8.000000119e-01f, 1.000000000e+00f, 8.000000119e-01f, 6.000000238e-01f,
+    4.000000060e-01f, 2.000000030e-01f, 2.000000030e-01f, 4.000000060e-01f,
+    6.000000238e-01f, 8.000000119e-01f, 1.000000000e+00f, 8.333333135e-01f,
+    6.666666865e-01f, 5.000000000e-01f, 3.333333433e-01f, 1.666666716e-01f,
+    1.666666716e-01f, 3.333333433e-01f, 5.000000000e-01f, 6.666666865e-01f,
+    8.333333135e-01f, 1.000000000e+00f, 8.333333135e-01f, 6.666666865e-01f,
+    5.000000000e-01f, 3.333333433e-01f, 1.666666716e-01f, 1.666666716e-01f,
+    3.333333433e-01f, 5.000000000e-01f, 6.666666865e-01f, 8.333333135e-01f,
+    1.000000000e+00f, 8.333333135e-01f, 6.666666865e-01f, 5.000000000e-01f,
+    3.333333433e-01f, 1.666666716e-01f, 1.666666716e-01f, 3.333333433e-01f,
+    5.000000000e-01f, 6.666666865e-01f, 8.333333135e-01f, 1.000000000e+00f,
+    8.571428657e-01f, 7.142857313e-01f, 5.714285970e-01f, 4.285714328e-01f,
+    2.857142985e-01f, 1.428571492e-01f, 1.428571492e-01f, 2.857142985e-01f,
+    4.285714328e-01f, 5.714285970e-01f, 7.142857313e-01f, 8.571428657e-01f,
+    1.000000000e+00f, 8.571428657e-01f, 7.142857313e-01f, 5.714285970e-01f,
+    4.285714328e-01f, 2.857142985e-01f, 1.428571492e-01f, 1.428571492e-01f,
+    2.857142985e-01f, 4.285714328e-01f, 5.714285970e-01f, 7.142857313e-01f,
+    8.571428657e-01f, 1.000000000e+00f, 8.571428657e-01f, 7.142857313e-01f,
+    5.714285970e-01f, 4.285714328e-01f, 2.857142985e-01f, 1.428571492e-01f,
+    1.428571492e-01f, 2.857142985e-01f, 4.285714328e-01f, 5.714285970e-01f,
+    7.142857313e-01f, 8.571428657e-01f, 1.000000000e+00f, 8.750000000e-01f,
+    7.500000000e-01f, 6.250000000e-01f, 5.000000000e-01f, 3.750000000e-01f,
+    2.500000000e-01f, 1.250000000e-01f, 1.250000000e-01f, 2.500000000e-01f,
+    3.750000000e-01f, 5.000000000e-01f, 6.250000000e-01f, 7.500000000e-01f,
+    8.750000000e-01f, 1.000000000e+00f, 8.750000000e-01f, 7.500000000e-01f,
+    6.250000000e-01f, 5.000000000e-01f, 3.750000000e-01f, 2.500000000e-01f,
+    1.250000000e-01f, 1.250000000e-01f, 2.500000000e-01f, 3.750000000e-01f,
+    5.000000000e-01f, 6.250000000e-01f, 7.500000000e-01f, 8.750000000e-01f,
+    1.000000000e+00f, 8.888888955e-01f, 7.777777910e-01f, 6.666666865e-01f,
+    5.555555820e-01f, 4.444444478e-01f, 3.333333433e-01f, 2.222222239e-01f,
+    1.111111119e-01f, 1.111111119e-01f, 2.222222239e-01f, 3.333333433e-01f,
+    4.444444478e-01f, 5.555555820e-01f, 6.666666865e-01f, 7.777777910e-01f,
+    8.888888955e-01f, 1.000000000e+00f, 8.999999762e-01f, 8.000000119e-01f,
+    6.999999881e-01f, 6.000000238e-01f, 5.000000000e-01f, 4.000000060e-01f,
+    3.000000119e-01f, 2.000000030e-01f, 1.000000015e-01f, 1.000000015e-01f,
+    2.000000030e-01f, 3.000000119e-01f, 4.000000060e-01f, 5.000000000e-01f,
+    6.000000238e-01f, 6.999999881e-01f, 8.000000119e-01f, 8.999999762e-01f,
+    1.000000000e+00f, 8.999999762e-01f, 8.000000119e-01f, 6.999999881e-01f,
+    6.000000238e-01f, 5.000000000e-01f, 4.000000060e-01f, 3.000000119e-01f,
+    2.000000030e-01f, 1.000000015e-01f, 1.000000015e-01f, 2.000000030e-01f,
+    3.000000119e-01f, 4.000000060e-01f, 5.000000000e-01f, 6.000000238e-01f,
+    6.999999881e-01f, 8.000000119e-01f, 8.999999762e-01f, 1.000000000e+00f,
+    8.999999762e-01f, 8.000000119e-01f, 6.999999881e-01f, 6.000000238e-01f,
+    5.000000000e-01f, 4.000000060e-01f, 3.000000119e-01f, 2.000000030e-01f,
+    1.000000015e-01f, 1.000000015e-01f, 2.000000030e-01f, 3.000000119e-01f,
+    4.000000060e-01f, 5.000000000e-01f, 6.000000238e-01f, 6.999999881e-01f,
+    8.000000119e-01f, 8.999999762e-01f, 1.000000000e+00f, 9.090909362e-01f,
+    8.181818128e-01f, 7.272727489e-01f, 6.363636255e-01f, 5.454545617e-01f,
+    4.545454681e-01f, 3.636363745e-01f, 2.727272809e-01f, 1.818181872e-01f,
+    9.090909362e-02f, 9.090909362e-02f, 1.818181872e-01f, 2.727272809e-01f,
+    3.636363745e-01f, 4.545454681e-01f, 5.454545617e-01f, 6.363636255e-01f,
+    7.272727489e-01f, 8.181818128e-01f, 9.090909362e-01f, 1.000000000e+00f,
+    9.166666865e-01f, 8.333333135e-01f, 7.500000000e-01f, 6.666666865e-01f,
+    5.833333135e-01f, 5.000000000e-01f, 4.166666567e-01f, 3.333333433e-01f,
+    2.500000000e-01f, 1.666666716e-01f, 8.333333582e-02f, 8.333333582e-02f,
+    1.666666716e-01f, 2.500000000e-01f, 3.333333433e-01f, 4.166666567e-01f,
+    5.000000000e-01f, 5.833333135e-01f, 6.666666865e-01f, 7.500000000e-01f,
+    8.333333135e-01f, 9.166666865e-01f, 1.000000000e+00f, 9.166666865e-01f,
+    8.333333135e-01f, 7.500000000e-01f, 6.666666865e-01f, 5.833333135e-01f,
+    5.000000000e-01f, 4.166666567e-01f, 3.333333433e-01f, 2.500000000e-01f,
+    1.666666716e-01f, 8.333333582e-02f, 8.333333582e-02f, 1.666666716e-01f,
+    2.500000000e-01f, 3.333333433e-01f, 4.166666567e-01f, 5.000000000e-01f,
+    5.833333135e-01f, 6.666666865e-01f, 7.500000000e-01f, 8.333333135e-01f,
+    9.166666865e-01f, 1.000000000e+00f, 9.230769277e-01f, 8.461538553e-01f,
+    7.692307830e-01f, 6.923077106e-01f, 6.153846383e-01f, 5.384615660e-01f,
+    4.615384638e-01f, 3.846153915e-01f, 3.076923192e-01f, 2.307692319e-01f,
+    1.538461596e-01f, 7.692307979e-02f, 7.692307979e-02f, 1.538461596e-01f,
+    2.307692319e-01f, 3.076923192e-01f, 3.846153915e-01f, 4.615384638e-01f,
+    5.384615660e-01f, 6.153846383e-01f, 6.923077106e-01f, 7.692307830e-01f,
+    8.461538553e-01f, 9.230769277e-01f, 1.000000000e+00f, 9.285714030e-01f,
+    8.571428657e-01f, 7.857142687e-01f, 7.142857313e-01f, 6.428571343e-01f,
+    5.714285970e-01f, 5.000000000e-01f, 4.285714328e-01f, 3.571428657e-01f,
+    2.857142985e-01f, 2.142857164e-01f, 1.428571492e-01f, 7.142857462e-02f,
+    7.142857462e-02f, 1.428571492e-01f, 2.142857164e-01f, 2.857142985e-01f,
+    3.571428657e-01f, 4.285714328e-01f, 5.000000000e-01f, 5.714285970e-01f,
+    6.428571343e-01f, 7.142857313e-01f, 7.857142687e-01f, 8.571428657e-01f,
+    9.285714030e-01f, 1.000000000e+00f, 9.333333373e-01f, 8.666666746e-01f,
+    8.000000119e-01f, 7.333333492e-01f, 6.666666865e-01f, 6.000000238e-01f,
+    5.333333611e-01f, 4.666666687e-01f, 4.000000060e-01f, 3.333333433e-01f,
+    2.666666806e-01f, 2.000000030e-01f, 1.333333403e-01f, 6.666667014e-02f,
+};
+
+static const q15_t MFCC16K_FILTER_COEFS_Q15[424] = {
+    32767, 16384, 16384, 32767, 32767, 16384, 16384, 32767,
+    16384, 16384, 32767, 16384, 16384, 32767, 16384, 16384,
+    32767, 21845, 10923, 10923, 21845, 32767, 16384, 16384,
+    32767, 16384, 16384, 32767, 21845, 10923, 10923, 21845,
+    32767, 21845, 10923, 10923, 21845, 32767, 21845, 10923,
+    10923, 21845, 32767, 21845, 10923, 10923, 21845, 32767,
+    21845, 10923, 10923, 21845, 32767, 24576, 16384, 8192,
+    8192, 16384, 24576, 32767, 24576, 16384, 8192, 8192,
+    16384, 24576, 32767, 24576, 16384, 8192, 8192, 16384,
+    24576, 32767, 24576, 16384, 8192, 8192, 16384, 24576,
+    32767, 24576, 16384, 8192, 8192, 16384, 24576, 32767,
+    26214, 19661, 13107, 6554, 6554, 13107, 19661, 26214,
+    32767, 26214, 19661, 13107, 6554, 6554, 13107, 19661,
+    26214, 32767, 26214, 19661, 13107, 6554, 6554, 13107,
+    19661, 26214, 32767, 27307, 21845, 16384, 10923, 5461,
+    5461, 10923, 16384, 21845, 27307, 32767, 27307, 21845,
+    16384, 10923, 5461, 5461, 10923, 16384, 21845, 27307,
+    32767, 27307, 21845, 16384, 10923, 5461, 5461, 10923,
+    16384, 21845, 27307, 32767, 28087, 23406, 18725, 14043,
+    9362, 4681, 4681, 9362, 14043, 18725, 23406, 28087,
+    32767, 28087, 23406, 18725, 14043, 9362, 4681, 4681,
+    9362, 14043, 18725, 23406, 28087, 32767, 28087, 23406,
+    18725, 14043, 9362, 4681, 4681, 9362, 14043, 18725,
+    23406, 28087, 32767, 28672, 24576, 20480, 16384, 12288,
+    8192, 4096, 4096, 8192, 12288, 16384, 20480, 24576,
+    28672, 32767, 28672, 24576, 20480, 16384, 12288, 8192,
+    4096, 4096, 8192, 12288, 16384, 20480, 24576, 28672,
+    32767, 29127, 25486, 21845, 18204, 14564, 10923, 7282,
+    3641, 3641, 7282, 10923, 14564, 18204, 21845, 25486,
+    29127, 32767, 29491, 26214, 22938, 19661, 16384, 13107,
+    9830, 6554, 3277, 3277, 6554, 9830, 13107, 16384,
+    19661, 22938, 26214, 29491, 32767, 29491, 26214, 22938,
+    19661, 16384, 13107, 9830, 6554, 3277, 3277, 6554,
+    9830, 13107, 16384, 19661, 22938, 26214, 29491, 32767,
+    29491, 26214, 22938, 19661, 16384, 13107, 9830, 6554,
+    3277, 3277, 6554, 9830, 13107, 16384, 19661, 22938,
+    26214, 29491, 32767, 29789, 26810, 23831, 20852, 17873,
+    14895, 11916, 8937, 5958, 2979, 2979, 5958, 8937,
+    11916, 14895, 17873, 20852, 23831, 26810, 29789, 32767,
+    30037, 27307, 24576, 21845, 19115, 16384, 13653, 10923,
+    8192, 5461, 2731, 2731, 5461, 8192, 10923, 13653,
+    16384, 19115, 21845, 24576, 27307, 30037, 32767, 30037,
+    27307, 24576, 21845, 19115, 16384, 13653, 10923, 8192,
+    5461, 2731, 2731, 5461, 8192, 10923, 13653, 16384,
+    19115, 21845, 24576, 27307, 30037, 32767, 30247, 27727,
+    25206, 22686, 20165, 17644, 15124, 12603, 10082, 7562,
+    5041, 2521, 2521, 5041, 7562, 10082, 12603, 15124,
+    17644, 20165, 22686, 25206, 27727, 30247, 32767, 30427,
+    28087, 25746, 23406, 21065, 18725, 16384, 14043, 11703,
+    9362, 7022, 4681, 2341, 2341, 4681, 7022, 9362,
+    11703, 14043, 16384, 18725, 21065, 23406, 25746, 28087,
+    30427, 32767, 30583, 28399, 26214, 24030, 21845, 19661,
+    17476, 15292, 13107, 10923, 8738, 6554, 4369, 2185,
+};
+
+static const float32_t MFCC16K_WINDOW_F32[512] = {
+    7.999999821e-02f, 8.003477007e-02f, 8.013908565e-02f, 8.031292260e-02f,
+    8.055625856e-02f, 8.086905628e-02f, 8.125127107e-02f, 8.170283586e-02f,
+    8.222369850e-02f, 8.281376213e-02f, 8.347295225e-02f, 8.420115709e-02f,
+    8.499827236e-02f, 8.586418629e-02f, 8.679874986e-02f, 8.780183643e-02f,
+    8.887328953e-02f, 9.001294523e-02f, 9.122063220e-02f, 9.249616414e-02f,
+    9.383936226e-02f, 9.525000304e-02f, 9.672789276e-02f, 9.827279299e-02f,
+    9.988448024e-02f, 1.015627086e-01f, 1.033072174e-01f, 1.051177531e-01f,
+    1.069940329e-01f, 1.089357808e-01f, 1.109426990e-01f, 1.130144820e-01f,
+    1.151508242e-01f, 1.173513904e-01f, 1.196158603e-01f, 1.219438836e-01f,
+    1.243351176e-01f, 1.267891824e-01f, 1.293057352e-01f, 1.318843663e-01f,
+    1.345247030e-01f, 1.372263432e-01f, 1.399888843e-01f, 1.428118944e-01f,
+    1.456949562e-01f, 1.486376226e-01f, 1.516394615e-01f, 1.547000259e-01f,
+    1.578188241e-01f, 1.609954238e-01f, 1.642293036e-01f, 1.675200015e-01f,
+    1.708670259e-01f, 1.742698401e-01f, 1.777279526e-01f, 1.812408417e-01f,
+    1.848079711e-01f, 1.884288043e-01f, 1.921027750e-01f, 1.958293468e-01f,
+    1.996079683e-01f, 2.034380287e-01f, 2.073189914e-01f, 2.112502456e-01f,
+    2.152311951e-01f, 2.192612588e-01f, 2.233397961e-01f, 2.274662256e-01f,
+    2.316398919e-01f, 2.358601838e-01f, 2.401264608e-01f, 2.444380671e-01f,
+    2.487943619e-01f, 2.531946898e-01f, 2.576383650e-01f, 2.621247470e-01f,
+    2.666531205e-01f, 2.712228298e-01f, 2.758331895e-01f, 2.804834545e-01f,
+    2.851729989e-01f, 2.899010479e-01f, 2.946668863e-01f, 2.994698286e-01f,
+    3.043091595e-01f, 3.091841042e-01f, 3.140939474e-01f, 3.190379441e-01f,
+    3.240153491e-01f, 3.290253878e-01f, 3.340673447e-01f, 3.391404450e-01f,
+    3.442438841e-01f, 3.493769467e-01f, 3.545387983e-01f, 3.597287238e-01f,
+    3.649458885e-01f, 3.701895177e-01f, 3.754588068e-01f, 3.807529807e-01f,
+    3.860712349e-01f, 3.914127648e-01f, 3.967767656e-01f, 4.021624029e-01f,
+    4.075689018e-01f, 4.129953980e-01f, 4.184410870e-01f, 4.239051938e-01f,
+    4.293868244e-01f, 4.348851740e-01f, 4.403994381e-01f, 4.459287524e-01f,
+    4.514722824e-01f, 4.570291936e-01f, 4.625986516e-01f, 4.681798220e-01f,
+    4.737718403e-01f, 4.793738723e-01f, 4.849850535e-01f, 4.906045794e-01f,
+    4.962315559e-01f, 5.018651485e-01f, 5.075045228e-01f, 5.131487846e-01f,
+    5.187971592e-01f, 5.244486928e-01f, 5.301026106e-01f, 5.357579589e-01f,
+    5.414140224e-01f, 5.470698476e-01f, 5.527245998e-01f, 5.583774447e-01f,
+    5.640274882e-01f, 5.696738958e-01f, 5.753158331e-01f, 5.809524059e-01f,
+    5.865827799e-01f, 5.922061801e-01f, 5.978216529e-01f, 6.034283638e-01f,
+    6.090254784e-01f, 6.146121621e-01f, 6.201875806e-01f, 6.257508993e-01f,
+    6.313012242e-01f, 6.368377209e-01f, 6.423596144e-01f, 6.478660107e-01f,
+    6.533561349e-01f, 6.588290930e-01f, 6.642841101e-01f, 6.697202921e-01f,
+    6.751369238e-01f, 6.805330515e-01f, 6.859080195e-01f, 6.912608743e-01f,
+    6.965908408e-01f, 7.018971443e-01f, 7.071790099e-01f, 7.124355435e-01f,
+    7.176660895e-01f, 7.228696942e-01f, 7.280457020e-01f, 7.331932187e-01f,
+    7.383115888e-01f, 7.433999777e-01f, 7.484575510e-01f, 7.534836531e-01f,
+    7.584775090e-01f, 7.634382844e-01f, 7.683653235e-01f, 7.732577920e-01f,
+    7.781150341e-01f, 7.829362154e-01f, 7.877207398e-01f, 7.924677730e-01f,
+    7.971766591e-01f, 8.018466234e-01f, 8.064770103e-01f, 8.110671639e-01f,
+    8.156162500e-01f, 8.201237321e-01f, 8.245888352e-01f, 8.290109038e-01f,
+    8.333893418e-01f, 8.377233744e-01f, 8.420124054e-01f, 8.462557197e-01f,
+    8.504527807e-01f, 8.546029329e-01f, 8.587055206e-01f, 8.627598882e-01f,
+    8.667654395e-01f, 8.707216382e-01f, 8.746278286e-01f, 8.784834146e-01f,
+    8.822878003e-01f, 8.860404491e-01f, 8.897408247e-01f, 8.933882713e-01f,
+    8.969823122e-01f, 9.005224109e-01f, 9.040079713e-01f, 9.074385166e-01f,
+    9.108135104e-01f, 9.141324162e-01f, 9.173947573e-01f, 9.206000566e-01f,
+    9.237478375e-01f, 9.268375635e-01f, 9.298688173e-01f, 9.328411222e-01f,
+    9.357540607e-01f, 9.386071563e-01f, 9.413999915e-01f, 9.441320896e-01f,
+    9.468031526e-01f, 9.494127035e-01f, 9.519603252e-01f, 9.544456601e-01f,
+    9.568683505e-01f, 9.592280388e-01f, 9.615243673e-01f, 9.637569189e-01f,
+    9.659253955e-01f, 9.680294991e-01f, 9.700688720e-01f, 9.720432758e-01f,
+    9.739522934e-01f, 9.757957458e-01f, 9.775733352e-01f, 9.792847037e-01f,
+    9.809296727e-01f, 9.825080037e-01f, 9.840194583e-01f, 9.854637384e-01f,
+    9.868406653e-01f, 9.881500602e-01f, 9.893916845e-01f, 9.905654192e-01f,
+    9.916709661e-01f, 9.927082658e-01f, 9.936770797e-01f, 9.945773482e-01f,
+    9.954088926e-01f, 9.961715937e-01f, 9.968652725e-01f, 9.974899292e-01f,
+    9.980453849e-01f, 9.985316396e-01f, 9.989485145e-01f, 9.992960095e-01f,
+    9.995740652e-01f, 9.997826815e-01f, 9.999217391e-01f, 9.999912977e-01f,
+    9.999912977e-01f, 9.999217391e-01f, 9.997826815e-01f, 9.995740652e-01f,
+    9.992960095e-01f, 9.989485145e-01f, 9.985316396e-01f, 9.980453849e-01f,
+    9.974899292e-01f, 9.968652725e-01f, 9.961715937e-01f, 9.954088926e-01f,
+    9.945773482e-01f, 9.936770797e-01f, 9.927082658e-01f, 9.916709661e-01f,
+    9.905654192e-01f, 9.893916845e-01f, 9.881500602e-01f, 9.868406653e-01f,
+    9.854637384e-01f, 9.840194583e-01f, 9.825080037e-01f, 9.809296727e-01f,
+    9.792847037e-01f, 9.775733352e-01f, 9.757957458e-01f, 9.739522934e-01f,
+    9.720432758e-01f, 9.700688720e-01f, 9.680294991e-01f, 9.659253955e-01f,
+    9.637569189e-01f, 9.615243673e-01f, 9.592280388e-01f, 9.568683505e-01f,
+    9.544456601e-01f, 9.519603252e-01f, 9.494127035e-01f, 9.468031526e-01f,
+    9.441320896e-01f, 9.413999915e-01f, 9.386071563e-01f, 9.357540607e-01f,
+    9.328411222e-01f, 9.298688173e-01f, 9.268375635e-01f, 9.237478375e-01f,
+    9.206000566e-01f, 9.173947573e-01f, 9.141324162e-01f, 9.108135104e-01f,
+    9.074385166e-01f, 9.040079713e-01f, 9.005224109e-01f, 8.969823122e-01f,
+    8.933882713e-01f, 8.897408247e-01f, 8.860404491e-01f, 8.822878003e-01f,
+    8.784834146e-01f, 8.746278286e-01f, 8.707216382e-01f, 8.667654395e-01f,
+    8.627598882e-01f, 8.587055206e-01f, 8.546029329e-01f, 8.504527807e-01f,
+    8.462557197e-01f, 8.420124054e-01f, 8.377233744e-01f, 8.333893418e-01f,
+    8.290109038e-01f, 8.245888352e-01f, 8.201237321e-01f, 8.156162500e-01f,
+    8.110671639e-01f, 8.064770103e-01f, 8.018466234e-01f, 7.971766591e-01f,
+    7.924677730e-01f, 7.877207398e-01f, 7.829362154e-01f, 7.781150341e-01f,
+    7.732577920e-01f, 7.683653235e-01f, 7.634382844e-01f, 7.584775090e-01f,
+    7.534836531e-01f, 7.484575510e-01f, 7.433999777e-01f, 7.383115888e-01f,
+    7.331932187e-01f, 7.280457020e-01f, 7.228696942e-01f, 7.176660895e-01f,
+    7.124355435e-01f, 7.071790099e-01f, 7.018971443e-01f, 6.965908408e-01f,
+    6.912608743e-01f, 6.859080195e-01f, 6.805330515e-01f, 6.751369238e-01f,
+    6.697202921e-01f, 6.642841101e-01f, 6.588290930e-01f, 6.533561349e-01f,
+    6.478660107e-01f, 6.423596144e-01f, 6.368377209e-01f, 6.313012242e-01f,
+    6.257508993e-01f, 6.201875806e-01f, 6.146121621e-01f, 6.090254784e-01f,
+    6.034283638e-01f, 5.978216529e-01f, 5.922061801e-01f, 5.865827799e-01f,
+    5.809524059e-01f, 5.753158331e-01f, 5.696738958e-01f, 5.640274882e-01f,
+    5.583774447e-01f, 5.527245998e-01f, 5.470698476e-01f, 5.414140224e-01f,
+    5.357579589e-01f, 5.301026106e-01f, 5.244486928e-01f, 5.187971592e-01f,
+    5.131487846e-01f, 5.075045228e-01f, 5.018651485e-01f, 4.962315559e-01f,
+    4.906045794e-01f, 4.849850535e-01f, 4.793738723e-01f, 4.737718403e-01f,
+    4.681798220e-01f, 4.625986516e-01f, 4.570291936e-01f, 4.514722824e-01f,
+    4.459287524e-01f, 4.403994381e-01f, 4.348851740e-01f, 4.293868244e-01f,
+    4.239051938e-01f, 4.184410870e-01f, 4.129953980e-01f, 4.075689018e-01f,
+    4.021624029e-01f, 3.967767656e-01f, 3.914127648e-01f, 3.860712349e-01f,
+    3.807529807e-01f, 3.754588068e-01f, 3.701895177e-01f, 3.649458885e-01f,
+    3.597287238e-01f, 3.545387983e-01f, 3.493769467e-01f, 3.442438841e-01f,
+    3.391404450e-01f, 3.340673447e-01f, 3.290253878e-01f, 3.240153491e-01f,
+    3.190379441e-01f, 3.140939474e-01f, 3.091841042e-01f, 3.043091595e-01f,
+    2.994698286e-01f, 2.946668863e-01f, 2.899010479e-01f, 2.851729989e-01f,
+    2.804834545e-01f, 2.758331895e-01f, 2.712228298e-01f, 2.666531205e-01f,
+    2.621247470e-01f, 2.576383650e-01f, 2.531946898e-01f, 2.487943619e-01f,
+    2.444380671e-01f, 2.401264608e-01f, 2.358601838e-01f, 2.316398919e-01f,
+    2.274662256e-01f, 2.233397961e-01f, 2.192612588e-01f, 2.152311951e-01f,
+    2.112502456e-01f, 2.073189914e-01f, 2.034380287e-01f, 1.996079683e-01f,
+    1.958293468e-01f, 1.921027750e-01f, 1.884288043e-01f, 1.848079711e-01f,
+    1.812408417e-01f, 1.777279526e-01f, 1.742698401e-01f, 1.708670259e-01f,
+    1.675200015e-01f, 1.642293036e-01f, 1.609954238e-01f, 1.578188241e-01f,
+    1.547000259e-01f, 1.516394615e-01f, 1.486376226e-01f, 1.456949562e-01f,
+    1.428118944e-01f, 1.399888843e-01f, 1.372263432e-01f, 1.345247030e-01f,
+    1.318843663e-01f, 1.293057352e-01f, 1.267891824e-01f, 1.243351176e-01f,
+    1.219438836e-01f, 1.196158603e-01f, 1.173513904e-01f, 1.151508242e-01f,
+    1.130144820e-01f, 1.109426990e-01f, 1.089357808e-01f, 1.069940329e-01f,
+    1.051177531e-01f, 1.033072174e-01f, 1.015627086e-01f, 9.988448024e-02f,
+    9.827279299e-02f, 9.672789276e-02f, 9.525000304e-02f, 9.383936226e-02f,
+    9.249616414e-02f, 9.122063220e-02f, 9.001294523e-02f, 8.887328953e-02f,
+    8.780183643e-02f, 8.679874986e-02f, 8.586418629e-02f, 8.499827236e-02f,
+    8.420115709e-02f, 8.347295225e-02f, 8.281376213e-02f, 8.222369850e-02f,
+    8.170283586e-02f, 8.125127107e-02f, 8.086905628e-02f, 8.055625856e-02f,
+    8.031292260e-02f, 8.013908565e-02f, 8.003477007e-02f, 7.999999821e-02f,
+};
+
+static const q15_t MFCC16K_WINDOW_Q15[512] = {
+    2621, 2623, 2626, 2632, 2640, 2650, 2662, 2677,
+    2694, 2714, 2735, 2759, 2785, 2814, 2844, 2877,
+    2912, 2950, 2989, 3031, 3075, 3121, 3170, 3220,
+    3273, 3328, 3385, 3444, 3506, 3570, 3635, 3703,
+    3773, 3845, 3920, 3996, 4074, 4155, 4237, 4322,
+    4408, 4497, 4587, 4680, 4774, 4871, 4969, 5069,
+    5171, 5275, 5381, 5489, 5599, 5710, 5824, 5939,
+    6056, 6174, 6295, 6417, 6541, 6666, 6793, 6922,
+    7053, 7185, 7318, 7454, 7590, 7729, 7868, 8010,
+    8152, 8297, 8442, 8589, 8738, 8887, 9039, 9191,
+    9345, 9499, 9656, 9813, 9972, 10131, 10292, 10454,
+    10617, 10782, 10947, 11113, 11280, 11448, 11618, 11788,
+    11959, 12130, 12303, 12477, 12651, 12826, 13002, 13178,
+    13355, 13533, 13711, 13891, 14070, 14250, 14431, 14612,
+    14794, 14976, 15158, 15341, 15525, 15708, 15892, 16076,
+    16261, 16445, 16630, 16815, 17000, 17185, 17370, 17556,
+    17741, 17926, 18112, 18297, 18482, 18667, 18852, 19037,
+    19221, 19405, 19589, 19773, 19957, 20140, 20322, 20505,
+    20686, 20868, 21049, 21229, 21409, 21589, 21767, 21945,
+    22123, 22300, 22476, 22651, 22826, 23000, 23173, 23345,
+    23516, 23687, 23857, 24025, 24193, 24360, 24525, 24690,
+    24854, 25016, 25178, 25338, 25497, 25655, 25812, 25968,
+    26122, 26275, 26427, 26577, 26726, 26874, 27020, 27165,
+    27309, 27451, 27591, 27730, 27868, 28004, 28138, 28271,
+    28402, 28532, 28660, 28786, 28911, 29034, 29155, 29275,
+    29392, 29508, 29623, 29735, 29846, 29954, 30061, 30166,
+    30269, 30371, 30470, 30567, 30663, 30756, 30848, 30937,
+    31025, 31110, 31194, 31275, 31355, 31432, 31507, 31580,
+    31651, 31720, 31787, 31852, 31914, 31975, 32033, 32089,
+    32143, 32195, 32244, 32292, 32337, 32380, 32420, 32459,
+    32495, 32529, 32561, 32590, 32618, 32643, 32665, 32686,
+    32704, 32720, 32734, 32745, 32754, 32761, 32765, 32767,
+    32767, 32765, 32761, 32754, 32745, 32734, 32720, 32704,
+    32686, 32665, 32643, 32618, 32590, 32561, 32529, 32495,
+    32459, 32420, 32380, 32337, 32292, 32244, 32195, 32143,
+    32089, 32033, 31975, 31914, 31852, 31787, 31720, 31651,
+    31580, 31507, 31432, 31355, 31275, 31194, 31110, 31025,
+    30937, 30848, 30756, 30663, 30567, 30470, 30371, 30269,
+    30166, 30061, 29954, 29846, 29735, 29623, 29508, 29392,
+    29275, 29155, 29034, 28911, 28786, 28660, 28532, 28402,
+    28271, 28138, 28004, 27868, 27730, 27591, 27451, 27309,
+    27165, 27020, 26874, 26726, 26577, 26427, 26275, 26122,
+    25968, 25812, 25655, 25497, 25338, 25178, 25016, 24854,
+    24690, 24525, 24360, 24193, 24025, 23857, 23687, 23516,
+    23345, 23173, 23000, 22826, 22651, 22476, 22300, 22123,
+    21945, 21767, 21589, 21409, 21229, 21049, 20868, 20686,
+    20505, 20322, 20140, 19957, 19773, 19589, 19405, 19221,
+    19037, 18852, 18667, 18482, 18297, 18112, 17926, 17741,
+    17556, 17370, 17185, 17000, 16815, 16630, 16445, 16261,
+    16076, 15892, 15708, 15525, 15341, 15158, 14976, 14794,
+    14612, 14431, 14250, 14070, 13891, 13711, 13533, 13355,
+    13178, 13002, 12826, 12651, 12477, 12303, 12130, 11959,
+    11788, 11618, 11448, 11280, 11113, 10947, 10782, 10617,
+    10454, 10292, 10131, 9972, 9813, 9656, 9499, 9345,
+    9191, 9039, 8887, 8738, 8589, 8442, 8297, 8152,
+    8010, 7868, 7729, 7590, 7454, 7318, 7185, 7053,
+    6922, 6793, 6666, 6541, 6417, 6295, 6174, 6056,
+    5939, 5824, 5710, 5599, 5489, 5381, 5275, 5171,
+    5069, 4969, 4871, 4774, 4680, 4587, 4497, 4408,
+    4322, 4237, 4155, 4074, 3996, 3920, 3845, 3773,
+    3703, 3635, 3570, 3506, 3444, 3385, 3328, 3273,
+    3220, 3170, 3121, 3075, 3031, 2989, 2950, 2912,
+    2877, 2844, 2814, 2785, 2759, 2735, 2714, 2694,
+    2677, 2662, 2650, 2640, 2632, 2626, 2623, 2621,
+};
+
+#endif /* GALAXY_SDK_MFCC_TABLES_H_ */
@@ -4,9 +4,11 @@ import pandas as pd
 import numpy as np 
 import torch 
 from scipy.io import wavfile
+from scipy.signal import lfilter, lfilter_zi
 import time
 import random
 import math
+from gen_mfcc_tables import mfcc_tables, highpass_biquad, log2_lut_q16, MEL_FILTERS, HPF_CUTOFF_HZ, LOG2_LUT_BITS
 
 
 
@@ -67,6 +69,161 @@ class SpeechBlockManager:
 
 
 
+class RunningCMVN:
+    """
+    滑动倒谱均值方差归一化，与algo.c的cmvn_apply一致：
+    指数加权均值/方差，权重1/(n+1)，前window帧等价于累计平均，之后固定为1/window
+    """
+    def __init__(self, n_features=13, window=200, var_floor=1e-2):
+        self.n_features = n_features
+        self.window = window
+        self.var_floor = var_floor
+        self.reset()
+
+    def reset(self):
+        self.mean = np.zeros(self.n_features, dtype=np.float32)
+        self.var = np.zeros(self.n_features, dtype=np.float32)
+        self.count = 0
+
+    def apply(self, mfcc, update=True):
+        """返回归一化后的特征，update为True时先用该帧更新统计量（板端只用语音帧更新）"""
+        x = np.asarray(mfcc, dtype=np.float32)
+        if update:
+            w = np.float32(1.0 / (self.count + 1))
+            if self.count + 1 < self.window:
+                self.count += 1
+            diff = x - self.mean
+            self.mean = self.mean + w * diff
+            self.var = (1 - w) * (self.var + w * diff * diff)
+        return (x - self.mean) / np.sqrt(np.maximum(self.var, self.var_floor))
+
+
+FRAMES_PER_BLOCK = 72    # 每1.5秒块使用的帧数（algo.c的FRAMES_PER_BLOCK）
+GATE_ZCR_RATE = 3000     # 每秒过零次数上限（algo.c的GATE_ZCR_RATE）
+
+
+# 定点log2（与algo.c的log2_q16一致）：查表加线性插值，返回Q16
+LOG2_LUT_Q16 = log2_lut_q16(LOG2_LUT_BITS)
+DB_PER_LOG2_Q16 = 197283   # 10*log10(2) * 2^16
+
+
+def log2_q16(x):
+    x = max(int(x), 1)
+    msb = x.bit_length() - 1
+    frac = (x >> (msb - 16)) if msb >= 16 else (x << (16 - msb))
+    frac &= 0xFFFF
+    shift = 16 - LOG2_LUT_BITS
+    idx = frac >> shift
+    rem = frac & ((1 << shift) - 1)
+    y0 = LOG2_LUT_Q16[idx]
+    y1 = LOG2_LUT_Q16[idx + 1]
+    return (msb << 16) + y0 + (((y1 - y0) * rem) >> shift)
+
+
+def frame_zcr(frame, deadzone=64):
+    """过零次数，与algo.c的calculate_frame_zcr一致：以帧均值（截断取整）为零点，越过±deadzone才算换号"""
+    x = np.asarray(frame, dtype=np.int64)
+    mean = int(np.sum(x) / len(x))
+    hi, lo = mean + deadzone, mean - deadzone
+    sign, crossings = 0, 0
+    for v in x:
+        if v > hi:
+            crossings += sign < 0
+            sign = 1
+        elif v < lo:
+            crossings += sign > 0
+            sign = -1
+    return crossings
+
+
+class AdaptiveVAD:
+    """
+    两级语音检测，与algo.c的pre_gate/vad_update一致（帧能量取整数分贝）：
+    第一级：能量不低于min_db、（语音段外）高出噪声底snr_db、过零次数不超过zcr_max；
+    第二级：最小值统计跟踪噪声底，通过第一级且高出噪声底snr_db为语音候选，
+    连续onset帧候选进入语音段，候选结束后保持hangover帧
+    """
+    def __init__(self, subwin_frames=25, subwins=6, snr_db=10, min_db=20, zcr_max=150, onset=3, hangover=10):
+        self.subwin_frames = subwin_frames
+        self.subwins = subwins
+        self.snr_db = snr_db
+        self.min_db = min_db
+        self.zcr_max = zcr_max
+        self.onset_frames = onset
+        self.hangover_frames = hangover
+        self.reset()
+
+    def reset(self):
+        self.sub_min = [np.inf] * self.subwins
+        self.cur_min = np.inf
+        self.sub_frames = 0
+        self.sub_idx = 0
+        self.onset = 0
+        self.hangover = 0
+        self.active = 0
+        self.noise_floor = np.inf
+
+    def pre_gate(self, frame, energy):
+        """第一级预门限，返回0/1"""
+        energy = int(energy)
+        if energy < self.min_db or (not self.active and energy < self.noise_floor + self.snr_db):
+            return 0
+        return int(frame_zcr(frame) <= self.zcr_max)
+
+    def update(self, energy, gate=1):
+        """输入一帧能量（分贝，按板端截断为整数）和第一级结果，返回0/1"""
+        energy = int(energy)
+        self.cur_min = min(self.cur_min, energy)
+        self.noise_floor = min(self.cur_min, min(self.sub_min))
+        self.sub_frames += 1
+        if self.sub_frames == self.subwin_frames:
+            self.sub_min[self.sub_idx] = self.cur_min
+            self.sub_idx = (self.sub_idx + 1) % self.subwins
+            self.cur_min = np.inf
+            self.sub_frames = 0
+
+        if gate and energy >= self.noise_floor + self.snr_db:
+            self.onset = min(self.onset + 1, self.onset_frames)
+            if self.onset >= self.onset_frames:
+                self.active = 1
+                self.hangover = self.hangover_frames
+        else:
+            self.onset = 0
+            if self.hangover > 0:
+                self.hangover -= 1
+            else:
+                self.active = 0
+        return int(self.active and gate)
+
+
+def regression_delta(feats, window=2):
+    """回归差分 d(t) = sum_k k*(c(t+k) - c(t-k)) / (2*sum_k k^2)，首尾复制边界帧"""
+    n = len(feats)
+    padded = np.pad(feats, ((window, window), (0, 0)), mode='edge')
+    denom = 2 * sum(k * k for k in range(1, window + 1))
+    return sum(k * (padded[window + k:window + k + n] - padded[window - k:window - k + n])
+               for k in range(1, window + 1)) / denom
+
+
+def add_deltas(static, order, window=2):
+    """
+    拼接一阶/二阶差分，与algo.c的delta_push/delta_flush一致：
+    序列末尾先补order*window个末帧，再在补齐后的序列上算差分
+
+    返回:
+        np.ndarray: shape=(n, n_mfcc*(order+1))
+    """
+    if order == 0:
+        return static
+    n = len(static)
+    extended = np.pad(static, ((0, order * window), (0, 0)), mode='edge')
+    delta = regression_delta(extended, window)
+    feats = [static, delta[:n]]
+    if order >= 2:
+        feats.append(regression_delta(delta[:n + window], window)[:n])
+    return np.hstack(feats).astype(np.float32)
+
+
 class AudioProcessor:
     def __init__(self, sample_rate=8000, frame_length=0.05, hop_length=0.02):
         """
@@ -77,16 +234,54 @@ class AudioProcessor:
             frame_length (float): 帧长（秒），默认0.025秒（25ms）
             hop_length (float): 帧移（秒），默认0.01秒（10ms）
         """
-    def __init__(self, n_mfcc=13, sr=8000, frame_length_ms=50, frame_shift_ms=20, preemphasis_coef=0.97, n_fft=512):
+    def __init__(self, n_mfcc=13, sr=8000, frame_length_ms=50, frame_shift_ms=20, preemphasis_coef=0.97, n_fft=512,
+                 board_frontend=True, cmvn=False, cmvn_window=200, delta_order=0, highpass=True):
         self.n_mfcc = n_mfcc          # 最终输出的MFCC系数数量（通常取13）
-        self.sr = sr                  # 采样率（8000Hz）
+        self.sr = sr                  # 采样率（8000或16000Hz，需与板端mfcc_select_rate选择的配置一致）
         self.frame_length = int(sr * frame_length_ms / 1000)  # 帧长（50ms→400点）
         self.frame_shift = int(sr * frame_shift_ms / 1000)    # 帧移（20ms→160点）
         self.preemphasis_coef = preemphasis_coef  # 预加重系数（通常0.95~0.97）
         self.n_fft = n_fft            # FFT窗口大小（需≥帧长，常用512）
         self.n_mels = n_mfcc + 2      # 梅尔滤波器数量（比n_mfcc多2，用于边界）
         self.n_fft_bins = self.n_fft // 2 + 1  # FFT有效频率点数（实数信号对称，取前半）
-        self.mel_filters = self._create_mel_filters()  # 预计算梅尔滤波器组                     # 帧移（秒）
+        self.board_frontend = board_frontend  # True：与板端algo.c使用同一份常量表（gen_mfcc_tables.py）
+        if board_frontend:
+            # 帧长、帧移、FFT点数和梅尔范围取gen_mfcc_tables.RATE_CONFIGS中该采样率的配置
+            tables = mfcc_tables(sr, MEL_FILTERS, n_mfcc)
+            self.frame_length = tables['frame_len']
+            self.frame_shift = tables['frame_shift']
+            self.n_fft = tables['fft_len']
+            self.n_fft_bins = self.n_fft // 2 + 1
+            self.window = tables['window']        # 汉明窗
+            self.mel_filters = tables['mel']      # 梅尔滤波器组（MEL_FILTERS × n_fft_bins）
+            self.dct_basis = tables['dct']        # 正交归一化DCT-II基矩阵（n_mfcc × MEL_FILTERS）
+        else:
+            self.mel_filters = self._create_mel_filters()  # 预计算梅尔滤波器组                     # 帧移（秒）
+        # 滑动CMVN（需与algo.c的CMVN_ENABLE/CMVN_WINDOW一致），None表示不归一化（默认关闭，与板端CMVN_ENABLE默认值相同）
+        self.cmvn = RunningCMVN(n_mfcc, cmvn_window) if cmvn else None
+        # 差分特征阶数（需与algo.c的DELTA_ORDER一致）：0-13维，1-26维，2-39维
+        self.delta_order = delta_order
+        self.n_features = n_mfcc * (delta_order + 1)
+        # 自适应VAD（与algo.c一致），只有语音帧提取特征；过零门限按每秒GATE_ZCR_RATE次换算到帧长
+        self.vad = AdaptiveVAD(zcr_max=self.frame_length * GATE_ZCR_RATE // sr)
+        # 采集高通（去直流），与板端capture_highpass一致，None表示不滤波
+        self.hpf = highpass_biquad(sr, HPF_CUTOFF_HZ) if highpass else None
+        self.hpf_state = None         # 滤波器状态，一段录音内跨块延续，None表示下一块是录音开头
+
+    def _highpass(self, audio):
+        """
+        二阶高通去直流，与板端capture_highpass一致：滤波器状态在一段录音内跨块延续，
+        只在录音开头以首个采样为稳态初值；结果向零截断回16位（riscv_float_to_q15不做舍入）。
+        板端按float32计算，这里按float64，个别采样可能相差1个量化单位。
+        """
+        x = np.asarray(audio, dtype=np.float64)
+        if len(x) == 0:
+            return np.asarray(audio)
+        b, a = self.hpf
+        if self.hpf_state is None:
+            self.hpf_state = lfilter_zi(b, a) * x[0]
+        y, self.hpf_state = lfilter(b, a, x, zi=self.hpf_state)
+        return np.clip(np.trunc(y), -32768, 32767).astype(np.int16)
 
     def _frame_audio(self, audio):
         """
@@ -100,8 +295,9 @@ class AudioProcessor:
             frames (np.ndarray): 分帧后的音频（shape=(num_frames, frame_length)）
             frame_indices (list): 每帧在原始音频中的起始位置（采样点）
         """
-        # 计算总帧数
-        num_frames = (12000 - self.frame_length) // self.frame_shift
+        # 计算总帧数：每块1.5秒，与板端一样最多取前FRAMES_PER_BLOCK帧
+        block_len = self.sr * 3 // 2
+        num_frames = min((block_len - self.frame_length) // self.frame_shift, FRAMES_PER_BLOCK)
         frames = []
         audio = np.asarray(audio)  # 关键：转换为numpy数组
         for i in range(num_frames):
@@ -111,35 +307,25 @@ class AudioProcessor:
 
     def _cal_per_energy(self, frames):
         """
-        计算每帧的短时能量与RMS（内部辅助函数）
-        
+        计算每帧的短时能量（分贝），与板端calculate_frame_energy逐位一致（内部辅助函数）
+
+        以1个量化单位的有效值为0dB，即 10*log10(平方和/帧长)。板端用64位平方和、log2查表加线性插值，
+        结果截断取整，静音帧（平方和为0）按1计算约为-26dB；这里按同样的整数运算复现，
+        保证自适应VAD在门限附近与板端判决相同。
+
         参数:
             frames (np.ndarray): 分帧后的音频（shape=(num_frames, frame_length)）
-            
+
         返回:
-            energy (np.ndarray): 每帧的短时能量
-            rms_list (np.ndarray): 每帧的RMS（dB）
+            energys (list): 每帧的短时能量（dB，整数）
         """
         energys = []
         for frame in frames:
-            p_ref = 20e-6  # 20微帕
-            max_quant = 2 ** (16 - 1)
-            p_max = p_ref * max_quant  # 满量程声压（Pa）
-
-            frame_normalized = frame.astype(np.float32) / max_quant
-          
-            
-            # 转换为声压值（Pa）
-            p_samples = frame_normalized * p_max
-            
-            # ---------------------- 步骤3：计算有效声压（RMS） ----------------------
-            p_rms = np.sqrt(np.mean(p_samples ** 2))
-            
-            # ---------------------- 步骤4：计算分贝值 ----------------------
-            if p_rms == 0:
-                # 避免对数运算错误（静音返回-∞，实际中可设为极小值）
-                p_rms = p_rms + 1
-            db = 20 * np.log10(p_rms / p_ref)
+            square_sum = int(np.sum(np.asarray(frame, dtype=np.int64) ** 2))
+            log2_mean_q16 = log2_q16(square_sum) - log2_q16(len(frame))
+            prod = log2_mean_q16 * DB_PER_LOG2_Q16
+            # C的整数除法向零截断
+            db = prod >> 32 if prod >= 0 else -((-prod) >> 32)
             energys.append(db)
         return energys
 
@@ -246,6 +432,13 @@ class AudioProcessor:
 
 
 
+    def _board_mfcc(self, frame):
+        """与algo.c的compute_mfcc一致：预加重、加窗、补零FFT取功率谱、梅尔滤波、ln、DCT-II基矩阵"""
+        windowed = self._preemphasis(np.asarray(frame, dtype=np.float32)) * self.window
+        power_spectrum = np.abs(np.fft.rfft(windowed, n=self.n_fft)) ** 2
+        mel_energies = np.maximum(self.mel_filters @ power_spectrum, 1e-10)
+        return self.dct_basis @ np.log(mel_energies)
+
     def process(self, input_array):
         """
         处理输入的语音块数组，输出语音帧数组
@@ -260,13 +453,22 @@ class AudioProcessor:
                 （仅保留语音帧）
         """
         output_frames = []  # 存储最终输出的语音帧信息
+        last_person = None  # 换人（换一组录音）时重新统计CMVN、重新跟踪噪声底并重新初始化高通
 
         
         # 遍历每个输入的语音块
         for block in input_array:
             block_order,person_ids ,audio_data = block  # 解包块信息
+            if person_ids != last_person:
+                self.vad.reset()
+                self.hpf_state = None
+                if self.cmvn is not None:
+                    self.cmvn.reset()
+                last_person = person_ids
             
-            # 1. 分帧（生成帧数据和元信息）
+            # 1. 去直流后分帧（生成帧数据和元信息）
+            if self.hpf is not None:
+                audio_data = self._highpass(audio_data)
             frames = self._frame_audio(audio_data)
             num_frames = len(frames)
             # 2. 计算帧特征（能量）
@@ -275,9 +477,18 @@ class AudioProcessor:
             # 3. 生成帧顺序编号（全局唯一）
             frame_order = [block_order * 100 + i for i in range(num_frames)]  # 示例编号规则
 
-            # 4. 对每帧自主实现MFCC计算
+            # 4. 两级VAD（标记语音帧），非语音帧不提取特征
+            is_speech = [self.vad.update(e, self.vad.pre_gate(f, e)) for f, e in zip(frames, energys)]
+            speech_idx = [i for i in range(num_frames) if is_speech[i]]
+
+            # 5. 对每个语音帧自主实现MFCC计算
             frame_mfcc_list = []
-            for frame in frames:
+            for i in speech_idx:
+                frame = frames[i]
+                if self.board_frontend:
+                    frame_mfcc_list.append(self._board_mfcc(frame))
+                    continue
+
                 # 步骤1：预加重（提升高频）
                 preemphasized = self._preemphasis(frame)
                 
@@ -301,23 +512,24 @@ class AudioProcessor:
                 frame_mfcc = mfcc[:self.n_mfcc]
                 frame_mfcc_list.append(frame_mfcc)
             
+            if not speech_idx:
+                continue
+
+            # 6. 语音帧做CMVN并更新统计量，再在块内的语音帧序列上计算差分（与板端一致）
+            if self.cmvn is not None:
+                frame_mfcc_list = [self.cmvn.apply(m) for m in frame_mfcc_list]
+            block_feats = add_deltas(np.array(frame_mfcc_list, dtype=np.float32).reshape(-1, self.n_mfcc),
+                                     self.delta_order)
+
             # 7. 合并元信息（原块顺序、人员编号、帧顺序）
-            for i in range(num_frames):
+            for k, i in enumerate(speech_idx):
                 frame_info = {
                     'block_order': block_order,
                     'person_id': person_ids,
                     'frame_order': frame_order[i],
-                    'is_speech': 0 , # 初始化为非语音
-                    'mfcc': frame_mfcc_list[i]     # 自主实现的MFCC列表
+                    'is_speech': is_speech[i],
+                    'mfcc': block_feats[k]     # 静态倒谱（及差分）
                 }
-                
-                # 8. 应用VAD逻辑（标记语音帧）
-                # 条件1：能量高于平均能量
-                ave_energy = 40
-                is_high_energy = energys[i] >= ave_energy         
-                if is_high_energy:
-                    frame_info['is_speech'] = 1
-
                 output_frames.append(frame_info)
         
         # 9. 转换为输出数组（按原顺序排列，仅保留语音帧）
@@ -334,7 +546,7 @@ class AudioProcessor:
             f['person_id'], 
             f['frame_order'], 
             f['is_speech'],
-            np.array(f['mfcc'], dtype=np.float32)  # 转换为13维浮点数数组
+            np.array(f['mfcc'], dtype=np.float32)  # 转换为n_features维浮点数数组
         ) 
         for f in output_frames
     ], dtype=[
@@ -342,7 +554,7 @@ class AudioProcessor:
         ('person_id', int), 
         ('frame_order', int), 
         ('is_speech', int), 
-        ('mfcc', float, (13,))  # 固定MFCC维度为13
+        ('mfcc', float, (self.n_features,))  # 13/26/39维，见delta_order
     ])
          
         output_array = self.remove_zero_speech_rows(output_array)
@@ -351,4 +563,4 @@ class AudioProcessor:
 
 
 
-   
\ No newline at end of file
+   
\ No newline at end of file
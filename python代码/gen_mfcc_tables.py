@@ -0,0 +1,246 @@
+"""
+生成MFCC前端常量表（C头文件）：抽取抗混叠滤波器、采集高通滤波器、窗函数、稀疏梅尔滤波器、DCT基矩阵和log2查表。
+板端algo.c直接使用这些const表（链接到Flash的.rodata，启动时不再计算，也不占RAM），
+训练端dataloader0.py通过mfcc_tables()使用同一份表，保证两端特征一致。
+每种采样率（RATE_CONFIGS）生成一套带前缀的表（MFCC8K_*、MFCC16K_*），algo.c为每套表各特化一份前端内核。
+修改RATE_CONFIGS（包括梅尔频率范围，训练端也读取它，不提供命令行覆盖）、滤波器数量或倒谱维数后需重新运行本脚本。
+FFT旋转因子使用NMSIS-DSP库自带的常量表（同样位于.rodata），这里不再重复生成。
+工程没有自带的构建脚本，本脚本不由编译过程调用：生成的mfcc_tables.h随源码提交，修改参数后手动运行并提交新头文件，
+algo.c中的#error检查会发现头文件与algo.c参数不一致的情况。
+
+用法:
+    python gen_mfcc_tables.py [-o ../galaxy_sdk/mfcc_tables.h] [--mel-filters 40] [--n-mfcc 13]
+"""
+import argparse
+import math
+import os
+import numpy as np
+
+
+SAMPLE_RATE = 8000   # 默认采样率（Hz）
+# 各采样率的前端参数：帧长、帧移（两种采样率都是20ms，块内帧数和VAD/CMVN的时间常数不变）、
+# FFT点数和梅尔滤波器覆盖的频率范围。8kHz保持原参数（0~4kHz满带），已训练的模型不受影响；
+# 16kHz帧长取32ms使FFT仍为512点，梅尔范围限制在100~7600Hz，避开高通和抽取滤波器的过渡带
+RATE_CONFIGS = {
+    8000:  dict(frame_len=400, frame_shift=160, fft_len=512, fmin=0, fmax=4000),
+    16000: dict(frame_len=512, frame_shift=320, fft_len=512, fmin=100, fmax=7600),
+}
+MEL_FILTERS = 40     # 梅尔滤波器数量
+N_MFCC = 13          # 输出倒谱维数
+LOG2_LUT_BITS = 6    # log2查表索引位数（定点对数与帧能量使用）
+HPF_CUTOFF_HZ = 60   # 采集高通（去直流）截止频率
+DECIM_RATIOS = (2, 4, 6)     # PDM采样率与特征采样率之比
+DECIM_TAPS_PER_RATIO = 24    # 抗混叠FIR阶数 = 24 * 抽取倍数（8kHz输出时过渡带约3.4k~4.6kHz，阻带衰减54dB以上）
+
+
+def mel_filterbank(sample_rate, fft_len, n_filters, fmin=0, fmax=None):
+    """
+    按algo.c中create_mel_filters的公式（单精度）生成稀疏三角滤波器组，覆盖fmin~fmax（默认到奈奎斯特频率）
+
+    返回:
+        tuple: (filter_pos, filter_len, filter_coefs)
+            filter_pos (list): 每个滤波器第一个非零bin
+            filter_len (list): 每个滤波器非零权重个数
+            filter_coefs (np.ndarray): 所有非零权重依次拼接（float32）
+    """
+    f32 = np.float32
+    sr = f32(sample_rate)
+    if fmax is None:
+        fmax = sample_rate / 2
+    min_mel = f32(2595.0) * np.log10(f32(1.0) + f32(fmin) / f32(700.0), dtype=f32)
+    max_mel = f32(2595.0) * np.log10(f32(1.0) + f32(fmax) / f32(700.0), dtype=f32)
+    mel_points = [min_mel + (max_mel - min_mel) * f32(i) / f32(n_filters + 1) for i in range(n_filters + 2)]
+    hz_points = [f32(700.0) * (np.power(f32(10.0), m / f32(2595.0), dtype=f32) - f32(1.0))
+                 for m in mel_points]
+    bins = [int(np.floor(f32(fft_len + 1) * hz / sr)) for hz in hz_points]
+
+    filter_pos, filter_len, coefs = [], [], []
+    for m in range(1, n_filters + 1):
+        left, center, right = bins[m - 1], bins[m], bins[m + 1]
+        start, length = 0, 0
+        for k in range(left, min(right, fft_len // 2) + 1):
+            if k <= center:
+                weight = f32(k - left) / f32(center - left) if center != left else f32(1.0)
+            else:
+                weight = f32(right - k) / f32(right - center)
+            if weight <= 0:
+                continue
+            if length == 0:
+                start = k
+            coefs.append(weight)
+            length += 1
+        filter_pos.append(start)
+        filter_len.append(length)
+    return filter_pos, filter_len, np.array(coefs, dtype=f32)
+
+
+def hamming_window(frame_len, fft_len):
+    """汉明窗，长度补零到fft_len（补零部分权重为0，相当于帧补零）"""
+    n = np.arange(frame_len)
+    window = np.zeros(fft_len, dtype=np.float32)
+    window[:frame_len] = 0.54 - 0.46 * np.cos(2 * np.pi * n / (frame_len - 1))
+    return window
+
+
+def dct_basis(n_mfcc, n_filters):
+    """正交归一化DCT-II基矩阵（n_mfcc x n_filters）"""
+    basis = np.zeros((n_mfcc, n_filters), dtype=np.float32)
+    for i in range(n_mfcc):
+        scale = np.sqrt(1.0 / n_filters) if i == 0 else np.sqrt(2.0 / n_filters)
+        basis[i] = scale * np.cos(np.pi * i * (np.arange(n_filters) + 0.5) / n_filters)
+    return basis
+
+
+def highpass_biquad(sample_rate, cutoff):
+    """
+    二阶巴特沃斯高通（RBJ公式，Q=1/sqrt(2)）
+
+    返回:
+        tuple: (b, a) 归一化系数（a[0] = 1），可直接用于scipy.signal.lfilter
+    """
+    w0 = 2 * math.pi * cutoff / sample_rate
+    alpha = math.sin(w0) / math.sqrt(2)
+    a0 = 1 + alpha
+    b = np.array([(1 + math.cos(w0)) / 2, -(1 + math.cos(w0)), (1 + math.cos(w0)) / 2]) / a0
+    a = np.array([1.0, -2 * math.cos(w0) / a0, (1 - alpha) / a0])
+    return b, a
+
+
+def hpf_coefs_f32(sample_rate, cutoff):
+    """riscv_biquad_cascade_df2T_f32的系数排列：{b0, b1, b2, -a1, -a2}"""
+    b, a = highpass_biquad(sample_rate, cutoff)
+    return [b[0], b[1], b[2], -a[1], -a[2]]
+
+
+def decimation_fir(ratio, taps_per_ratio=DECIM_TAPS_PER_RATIO, beta=5.65):
+    """
+    抽取抗混叠低通：Kaiser窗sinc，截止频率为输出采样率的一半（归一化到输入采样率为0.5/ratio），
+    直流增益为1。过渡带宽度与抽取倍数无关（按输入采样率算阶数随倍数增加）。
+
+    返回:
+        np.ndarray: ratio * taps_per_ratio个系数（对称，无需按NMSIS要求倒序）
+    """
+    num_taps = ratio * taps_per_ratio
+    n = np.arange(num_taps) - (num_taps - 1) / 2.0
+    h = np.sinc(n / ratio) * np.kaiser(num_taps, beta)
+    return h / np.sum(h)
+
+
+def log2_lut_q16(bits):
+    """log2(1 + i / 2^bits)，i = 0..2^bits，Q16"""
+    size = 1 << bits
+    return [int(math.floor(math.log2(1.0 + i / size) * 65536.0 + 0.5)) for i in range(size + 1)]
+
+
+def mfcc_tables(sample_rate=SAMPLE_RATE, n_filters=MEL_FILTERS, n_mfcc=N_MFCC):
+    """
+    返回板端该采样率配置使用的帧参数和全部浮点表（训练端直接调用，与头文件中的数值完全相同）
+
+    返回:
+        dict: frame_len、frame_shift、fft_len（采样点数）；
+              window（frame_len点汉明窗）、mel（n_filters x (fft_len/2+1)稠密滤波器矩阵）、
+              dct（n_mfcc x n_filters正交归一化DCT-II基矩阵），均为float32；
+              hpf（采集高通的(b, a)）
+    """
+    cfg = RATE_CONFIGS[sample_rate]
+    frame_len, fft_len = cfg['frame_len'], cfg['fft_len']
+    filter_pos, filter_len, filter_coefs = mel_filterbank(sample_rate, fft_len, n_filters, cfg['fmin'], cfg['fmax'])
+    mel = np.zeros((n_filters, fft_len // 2 + 1), dtype=np.float32)
+    offset = 0
+    for m in range(n_filters):
+        mel[m, filter_pos[m]:filter_pos[m] + filter_len[m]] = filter_coefs[offset:offset + filter_len[m]]
+        offset += filter_len[m]
+    return {
+        'frame_len': frame_len,
+        'frame_shift': cfg['frame_shift'],
+        'fft_len': fft_len,
+        'window': hamming_window(frame_len, fft_len)[:frame_len],
+        'mel': mel,
+        'dct': dct_basis(n_mfcc, n_filters),
+        'hpf': highpass_biquad(sample_rate, HPF_CUTOFF_HZ),
+    }
+
+
+def to_q15(values):
+    """浮点转Q15（饱和）"""
+    return np.clip(np.round(np.asarray(values, dtype=np.float64) * 32768), -32768, 32767).astype(np.int16)
+
+
+def c_array(ctype, name, values, per_line=8):
+    """把一维数组格式化为C常量数组"""
+    if ctype == 'float32_t':
+        items = ['%.9ef' % v for v in values]
+    else:
+        items = ['%d' % v for v in values]
+    lines = []
+    for i in range(0, len(items), per_line):
+        lines.append('    ' + ', '.join(items[i:i + per_line]) + ',')
+    return '\nstatic const %s %s[%d] = {\n%s\n};\n' % (ctype, name, len(items), '\n'.join(lines))
+
+
+def rate_tables(sample_rate, n_filters):
+    """一种采样率的全部带前缀常量（MFCC8K_*、MFCC16K_*）"""
+    cfg = RATE_CONFIGS[sample_rate]
+    frame_len, fft_len = cfg['frame_len'], cfg['fft_len']
+    filter_pos, filter_len, filter_coefs = mel_filterbank(sample_rate, fft_len, n_filters, cfg['fmin'], cfg['fmax'])
+    window = hamming_window(frame_len, fft_len)
+    prefix = 'MFCC%dK_' % (sample_rate // 1000)
+
+    out = []
+    out.append('\n/* ---- %d Hz ---- */\n' % sample_rate)
+    out.append('#define %sSAMPLE_RATE %d\n' % (prefix, sample_rate))
+    out.append('#define %sFRAME_LEN %d\n' % (prefix, frame_len))
+    out.append('#define %sFRAME_SHIFT %d\n' % (prefix, cfg['frame_shift']))
+    out.append('#define %sFFT_LEN %d\n' % (prefix, fft_len))
+    out.append('#define %sFFT_LOG2_LEN %d\n' % (prefix, fft_len.bit_length() - 1))
+    out.append('#define %sFMIN_HZ %d\n' % (prefix, cfg['fmin']))
+    out.append('#define %sFMAX_HZ %d\n' % (prefix, cfg['fmax']))
+    out.append('#define %sFILTER_COEFS %d\n' % (prefix, len(filter_coefs)))
+    out.append(c_array('float32_t', prefix + 'HPF_COEFS_F32', hpf_coefs_f32(sample_rate, HPF_CUTOFF_HZ), 5))
+    out.append(c_array('uint32_t', prefix + 'FILTER_POS', filter_pos))
+    out.append(c_array('uint32_t', prefix + 'FILTER_LEN', filter_len))
+    out.append(c_array('float32_t', prefix + 'FILTER_COEFS_F32', filter_coefs, 4))
+    out.append(c_array('q15_t', prefix + 'FILTER_COEFS_Q15', to_q15(filter_coefs)))
+    out.append(c_array('float32_t', prefix + 'WINDOW_F32', window, 4))
+    out.append(c_array('q15_t', prefix + 'WINDOW_Q15', to_q15(window)))
+    return out
+
+
+def write_header(path, n_filters, n_mfcc):
+    dct = dct_basis(n_mfcc, n_filters)
+
+    out = []
+    out.append('/*\n * mfcc_tables.h\n *\n'
+               ' *  由python代码/gen_mfcc_tables.py自动生成，请勿手工修改\n */\n')
+    out.append('\n#ifndef GALAXY_SDK_MFCC_TABLES_H_\n#define GALAXY_SDK_MFCC_TABLES_H_\n\n')
+    out.append('#include "riscv_math.h"\n\n')
+    # 与采样率无关的表
+    out.append('#define MFCC_TABLE_MEL_FILTERS %d\n' % n_filters)
+    out.append('#define MFCC_TABLE_N_MFCC %d\n' % n_mfcc)
+    out.append('#define MFCC_TABLE_LOG2_LUT_BITS %d\n' % LOG2_LUT_BITS)
+    out.append('#define MFCC_TABLE_HPF_CUTOFF_HZ %d\n' % HPF_CUTOFF_HZ)
+    out.append('#define MFCC_TABLE_DECIM_TAPS_PER_RATIO %d\n' % DECIM_TAPS_PER_RATIO)
+    for ratio in DECIM_RATIOS:
+        out.append(c_array('q15_t', 'MFCC_DECIM%d_TAPS_Q15' % ratio, to_q15(decimation_fir(ratio))))
+    out.append(c_array('float32_t', 'MFCC_DCT_COEFS_F32', dct.reshape(-1), 4))
+    out.append(c_array('float32_t', 'MFCC_DCT_COEFS_T_F32', dct.T.reshape(-1), 4))
+    out.append(c_array('q15_t', 'MFCC_DCT_COEFS_Q15', to_q15(dct.reshape(-1))))
+    out.append(c_array('int32_t', 'MFCC_LOG2_LUT_Q16', log2_lut_q16(LOG2_LUT_BITS)))
+    # 各采样率的表
+    for sample_rate in sorted(RATE_CONFIGS):
+        out.extend(rate_tables(sample_rate, n_filters))
+    out.append('\n#endif /* GALAXY_SDK_MFCC_TABLES_H_ */\n')
+
+    with open(path, 'w', newline='\n') as f:
+        f.write(''.join(out))
+
+
+if __name__ == "__main__":
+    default_out = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                               '..', 'galaxy_sdk', 'mfcc_tables.h')
+    parser = argparse.ArgumentParser(description='生成MFCC前端常量表')
+    parser.add_argument('-o', '--output', default=default_out)
+    parser.add_argument('--mel-filters', type=int, default=MEL_FILTERS)
+    parser.add_argument('--n-mfcc', type=int, default=N_MFCC)
+    args = parser.parse_args()
+    write_header(args.output, args.mel_filters, args.n_mfcc)
@@ -4,11 +4,21 @@ from scipy.io import wavfile
 from dataloader0 import SpeechBlockManager,AudioProcessor
 from sklearn.mixture import GaussianMixture
 import joblib
+import copy
 from pathlib import Path
 
 
-# 创建模型保存目录
-model_dir = Path(r"D:\my_vs_code\per\VeriHealthi_QEMU_SDK.202505_preliminary\VeriHealthi_QEMU_SDK.202505_preliminary\VerHealthi_preliminary\models")
+N_COMPONENTS = 64   # GMM分量数，需与algo.c的N_COMPONENTS一致
+USE_CMVN = False    # 滑动CMVN，需与algo.c的CMVN_ENABLE一致（两边同时打开并重新导出模型）
+DELTA_ORDER = 0     # 差分特征阶数（0/1/2 -> 13/26/39维），需与algo.h的DELTA_ORDER一致
+SAMPLE_RATE = 8000  # 特征采样率（8000/16000），需与板端main.c的ALGO_SAMPLE_RATE一致
+MAP_RELEVANCE = 16  # MAP自适应的相关因子；说话人模型由UBM均值自适应得到，分量与UBM一一对应（板端Top-C打分的前提）
+# 板端按采样率从不同目录加载模型（algo.c的mfcc_rates），两种采样率的模型不能混用
+MODEL_SUBDIR = 'models' if SAMPLE_RATE == 8000 else 'models/%dk' % (SAMPLE_RATE // 1000)
+
+# 创建模型保存目录，训练结果（pkl/npz/bin）都写在这里
+model_root = Path(r"D:\my_vs_code\per\VeriHealthi_QEMU_SDK.202505_preliminary\VeriHealthi_QEMU_SDK.202505_preliminary\VerHealthi_preliminary")
+model_dir = model_root / MODEL_SUBDIR
 model_dir.mkdir(parents=True, exist_ok=True)
 
 def split_wav_into_1_5s(folder_path):
@@ -38,6 +48,9 @@ def split_wav_into_1_5s(folder_path):
             except Exception as e:
                 print(f"警告：跳过无法读取的文件 {file}，错误：{str(e)}")
                 continue
+            if sample_rate != SAMPLE_RATE:
+                print(f"警告：跳过采样率为{sample_rate}Hz的文件 {file}（当前按{SAMPLE_RATE}Hz训练）")
+                continue
             
             samples_per_block = int(1.5 * sample_rate)
             total_samples = audio_data.shape[0]
@@ -71,7 +84,7 @@ def split_bin_into_1_5s(folder_path):
                 if f.lower().endswith('.bin')]
     
     blocks_list = []
-    sample_rate = 8000  # 固定采样率8000 Hz
+    sample_rate = SAMPLE_RATE  # BIN文件没有头部，按当前训练采样率解释
     samples_per_block = int(1.5 * sample_rate)  # 1.5秒的样本数
     
     for file in bin_files:
@@ -110,6 +123,20 @@ def split_train_and_test(mfcc_datas,labels):
     return train_dataset,test_dataset 
 
 
+def map_adapt_means(ubm, X, relevance=MAP_RELEVANCE):
+    """
+    GMM-UBM的MAP均值自适应：权重和方差沿用UBM，只更新均值
+    分量k的新均值 = a_k * E_k[x] + (1 - a_k) * UBM均值，a_k = n_k / (n_k + relevance)
+    """
+    post = ubm.predict_proba(X)                      # (帧数, 分量数)
+    n_k = post.sum(axis=0)
+    ex = (post.T @ X) / np.maximum(n_k, 1e-10)[:, None]
+    alpha = (n_k / (n_k + relevance))[:, None]
+    model = copy.deepcopy(ubm)
+    model.means_ = alpha * ex + (1 - alpha) * ubm.means_
+    return model
+
+
 def train_speaker_models(speaker_data, n_components=64):
     models = {}
     
@@ -216,43 +243,35 @@ if __name__ == "__main__":
 
     
     audio_processor = AudioProcessor(
-    n_mfcc=13,sr=8000
+    n_mfcc=13,sr=SAMPLE_RATE,cmvn=USE_CMVN,delta_order=DELTA_ORDER
 )
     #给所有识别人训练一个基准gmm，来判断输入是否为七人中的一个
     blocks_ubm_data = block_manager.get_all_blocks()
     blocks_ubm_data = audio_processor.process(blocks_ubm_data)
     all_datas = blocks_ubm_data['mfcc']
-    ubm = GaussianMixture(n_components=64,covariance_type='diag',max_iter=100)
+    ubm = GaussianMixture(n_components=N_COMPONENTS,covariance_type='diag',max_iter=100)
     ubm.fit(all_datas)
 
 
     output_array_xiaoXin = audio_processor.process(blocks_train_xiaoXin)
     X_xiaoXin = output_array_xiaoXin['mfcc']
     y_xiaoXin = output_array_xiaoXin['person_id']
-    gmm_xiaoXin = GaussianMixture(n_components=64, covariance_type='diag', max_iter=100)
-    gmm_xiaoXin.weights_init = ubm.weights_  # 用UBM初始化
-    gmm_xiaoXin.means_init = ubm.means_
-    gmm_xiaoXin.fit(X_xiaoXin)
+    gmm_xiaoXin = map_adapt_means(ubm, X_xiaoXin)
 
     output_array_xiaoYuan = audio_processor.process(blocks_train_xiaoYuan)
     X_xiaoYuan = output_array_xiaoYuan['mfcc']
     y_xiaoYuan = output_array_xiaoYuan['person_id']
-    gmm_xiaoYuan = GaussianMixture(n_components=64, covariance_type='diag', max_iter=100)
-    gmm_xiaoYuan.weights_init = ubm.weights_  # 用UBM初始化
-    gmm_xiaoYuan.means_init = ubm.means_
-    gmm_xiaoYuan.fit(X_xiaoYuan)
-
-    target_speakers = ["xiaoXin", "xiaoYuan"]
-
-    ubm = joblib.load(model_dir / "ubm_model.pkl")
-    np.savez(model_dir / "ubm_params.npz", 
-            weights=ubm.weights_,
-            means=ubm.means_,
-            covariances=ubm.covariances_)
+    gmm_xiaoYuan = map_adapt_means(ubm, X_xiaoYuan)
 
-    for speaker in target_speakers:
-        model = joblib.load(model_dir / f"gmm_{speaker}.pkl")
-        np.savez(model_dir / f"gmm_{speaker}_params.npz",
+    # 直接导出本次训练的UBM和MAP自适应模型（不要从旧的pkl重新加载，否则导出的仍是旧模型）
+    trained_models = {
+        "ubm": ubm,
+        "gmm_xiaoXin": gmm_xiaoXin,
+        "gmm_xiaoYuan": gmm_xiaoYuan,
+    }
+    for name, model in trained_models.items():
+        joblib.dump(model, model_dir / ("ubm_model.pkl" if name == "ubm" else f"{name}.pkl"))
+        np.savez(model_dir / f"{name}_params.npz",
                 weights=model.weights_,
                 means=model.means_,
                 covariances=model.covariances_)
@@ -270,7 +289,6 @@ if __name__ == "__main__":
                 row.astype('float32').tofile(f)
 
     # 转换所有模型
-    convert_to_bin('models/ubm_params.npz', 'models/ubm_params.bin')
-    convert_to_bin('models/gmm_xiaoXin_params.npz', 'models/gmm_xiaoXin_params.bin')
-    convert_to_bin('models/gmm_xiaoYuan_params.npz', 'models/gmm_xiaoYuan_params.bin')
-    
\ No newline at end of file
+    for name in trained_models:
+        convert_to_bin(model_dir / f'{name}_params.npz', model_dir / f'{name}_params.bin')
+    
\ No newline at end of file